@@ -18,6 +18,10 @@ copy_to   = "/sphenix/user/danderson/sphenix/analysis/EnergyCorrelatorsJets/Cold
 # what files to copy
 to_copy = [
   "README.md",
+  "src/BootstrapWeights.cc",
+  "src/BootstrapWeights.h",
+  "src/ClustColumns.cc",
+  "src/ClustColumns.h",
   "src/ClustInfo.cc",
   "src/ClustInfo.h",
   "src/ClustInterfaces.cc",
@@ -25,10 +29,23 @@ to_copy = [
   "src/ClustTools.cc",
   "src/ClustTools.h",
   "src/Constants.h",
+  "src/CstColumns.cc",
+  "src/CstColumns.h",
   "src/CstInfo.cc",
   "src/CstInfo.h",
   "src/CstInterfaces.cc",
   "src/CstInterfaces.h",
+  "src/CstTools.cc",
+  "src/CstTools.h",
+  "src/Cut.h",
+  "src/EECEngine.cc",
+  "src/EECEngine.h",
+  "src/ENCEngine.cc",
+  "src/ENCEngine.h",
+  "src/EventContext.cc",
+  "src/EventContext.h",
+  "src/FlowColumns.cc",
+  "src/FlowColumns.h",
   "src/FlowInfo.cc",
   "src/FlowInfo.h",
   "src/FlowInterfaces.cc",
@@ -37,11 +54,17 @@ to_copy = [
   "src/GEvtInfo.h",
   "src/GEvtTools.cc",
   "src/GEvtTools.h",
+  "src/HistAccumulator.cc",
+  "src/HistAccumulator.h",
   "src/Interfaces.h",
+  "src/JetColumns.cc",
+  "src/JetColumns.h",
   "src/JetInfo.cc",
   "src/JetInfo.h",
   "src/NodeInterfaces.cc",
   "src/NodeInterfaces.h",
+  "src/ParColumns.cc",
+  "src/ParColumns.h",
   "src/ParInfo.cc",
   "src/ParInfo.h",
   "src/ParInterfaces.cc",
@@ -52,14 +75,24 @@ to_copy = [
   "src/REvtInfo.h",
   "src/REvtTools.cc",
   "src/REvtTools.h",
+  "src/SigmaDcaModel.cc",
+  "src/SigmaDcaModel.h",
+  "src/TrackTruthMatchTable.cc",
+  "src/TrackTruthMatchTable.h",
   "src/TreeInterfaces.cc",
   "src/TreeInterfaces.h",
+  "src/TrkColumns.cc",
+  "src/TrkColumns.h",
   "src/TrkInfo.cc",
   "src/TrkInfo.h",
   "src/TrkInterfaces.cc",
   "src/TrkInterfaces.h",
   "src/TrkTools.cc",
   "src/TrkTools.h",
+  "src/TwrColumns.cc",
+  "src/TwrColumns.h",
+  "src/TwrGeoTable.cc",
+  "src/TwrGeoTable.h",
   "src/TwrInfo.cc",
   "src/TwrInfo.h",
   "src/TwrInterfaces.cc",
@@ -73,6 +106,10 @@ to_copy = [
   "src/TupleInterfaces.h",
   "src/VtxInterfaces.cc",
   "src/VtxInterfaces.h",
+  "src/testcstjetkinematics.cc",
+  "src/testcut.cc",
+  "src/testeecengine.cc",
+  "src/testencengine.cc",
   "scripts/copy-to-analysis.rb",
   "scripts/wipe-source.sh"
 ]
@@ -0,0 +1,105 @@
+/// ---------------------------------------------------------------------------
+/*! \file   BootstrapWeights.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event Poisson bootstrap replica weights
+ *  from a counter-based random number generator.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_BOOTSTRAPWEIGHTS_CC
+
+// class definition
+#include "BootstrapWeights.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Generate replica weights for an event
+  // --------------------------------------------------------------------------
+  void Types::BootstrapWeights::SetEvent(const uint64_t event) {
+
+    for (size_t replica = 0; replica < nReplicas; ++replica) {
+      weights[replica] = GetWeight(seed, event, replica);
+    }
+    return;
+
+  }  // end 'SetEvent(uint64_t)'
+
+
+
+  // static methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Scramble a 64-bit key (SplitMix64 finalizer)
+  // --------------------------------------------------------------------------
+  uint64_t Types::BootstrapWeights::Mix(const uint64_t key) {
+
+    uint64_t mixed = key;
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+    return mixed ^ (mixed >> 31);
+
+  }  // end 'Mix(uint64_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get the Poisson(1) weight of a replica in an event
+  // --------------------------------------------------------------------------
+  /*! The uniform draw is the top 53 bits of
+   *  a hash of (seed, event, replica), which
+   *  is then inverted through the Poisson(1)
+   *  CDF. Draws above k = 20 (p ~ 1e-19)
+   *  are clamped.
+   */
+  double Types::BootstrapWeights::GetWeight(
+    const uint64_t seed,
+    const uint64_t event,
+    const uint64_t replica
+  ) {
+
+    // counter-based uniform in [0, 1)
+    const uint64_t golden = 0x9e3779b97f4a7c15ULL;
+    const uint64_t key    = Mix(seed + (golden * Mix(event + golden)));
+    const double   unif   = (Mix(key + (golden * (replica + 1))) >> 11) * 0x1.0p-53;
+
+    // invert Poisson(1) cdf
+    size_t count = 0;
+    double prob  = exp(-1.);
+    double cdf   = prob;
+    while ((unif >= cdf) && (count < 20)) {
+      ++count;
+      prob /= count;
+      cdf  += prob;
+    }
+    return (double) count;
+
+  }  // end 'GetWeight(uint64_t, uint64_t, uint64_t)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting number of replicas and seed
+  // --------------------------------------------------------------------------
+  Types::BootstrapWeights::BootstrapWeights(const size_t replicas, const uint64_t rngSeed) {
+
+    nReplicas = replicas;
+    seed      = rngSeed;
+    weights.assign(nReplicas, 1.);
+
+  }  // end ctor(size_t, uint64_t)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,82 @@
+/// ---------------------------------------------------------------------------
+/*! \file   BootstrapWeights.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event Poisson bootstrap replica weights
+ *  from a counter-based random number generator.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_BOOTSTRAPWEIGHTS_H
+#define SCORRELATORUTILITIES_BOOTSTRAPWEIGHTS_H
+
+// c++ utilities
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Poisson(1) bootstrap weights for a set of replicas
+    // ------------------------------------------------------------------------
+    /*! The weight of replica r in an event is a
+     *  Poisson(1) draw from a hash of (seed,
+     *  event number, r), with no generator state.
+     *  So an event gets the same weights no matter
+     *  which job, thread, or order it is processed
+     *  in, and replicas can be rebuilt from the
+     *  event number alone, e.g.
+     *
+     *    BootstrapWeights boot(100);
+     *    engine.SetNReplicas(100);
+     *    // ... then for each event ...
+     *    boot.SetEvent(evtNumber);
+     *    engine.SetReplicaWeights(boot.GetWeights());
+     */
+    class BootstrapWeights {
+
+      private:
+
+        // data members
+        size_t         nReplicas = 0;
+        uint64_t       seed      = 0;
+        vector<double> weights;
+
+      public:
+
+        // getters
+        size_t                GetNReplicas() const {return nReplicas;}
+        uint64_t              GetSeed()      const {return seed;}
+        const vector<double>& GetWeights()   const {return weights;}
+
+        // public methods
+        void SetEvent(const uint64_t event);
+
+        // static methods
+        static uint64_t Mix(const uint64_t key);
+        static double   GetWeight(const uint64_t seed, const uint64_t event, const uint64_t replica);
+
+        // default ctor/dtor
+        BootstrapWeights()  {};
+        ~BootstrapWeights() {};
+
+        // ctor accepting arguments
+        BootstrapWeights(const size_t replicas, const uint64_t rngSeed = 0);
+
+    };  // end BootstrapWeights def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,258 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ClustColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for calorimeter cluster info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CLUSTCOLUMNS_CC
+
+// class definition
+#include "ClustColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a ClustInfo
+  // --------------------------------------------------------------------------
+  Types::ClustInfo Types::ClustColumns::GetInfo(const size_t row) const {
+
+    ClustInfo info;
+    info.SetSystem( system[row] );
+    info.SetID( id[row] );
+    info.SetNTwr( nTwr[row] );
+    info.SetEne( ene[row] );
+    info.SetRho( rho[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetRX( rx[row] );
+    info.SetRY( ry[row] );
+    info.SetRZ( rz[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of ClustInfo
+  // --------------------------------------------------------------------------
+  vector<Types::ClustInfo> Types::ClustColumns::GetInfos() const {
+
+    vector<ClustInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a ClustInfo
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::SetRow(const size_t row, const ClustInfo& info) {
+
+    system[row] = info.GetSystem();
+    id    [row] = info.GetID();
+    nTwr  [row] = info.GetNTwr();
+    ene   [row] = info.GetEne();
+    rho   [row] = info.GetRho();
+    eta   [row] = info.GetEta();
+    phi   [row] = info.GetPhi();
+    px    [row] = info.GetPX();
+    py    [row] = info.GetPY();
+    pz    [row] = info.GetPZ();
+    rx    [row] = info.GetRX();
+    ry    [row] = info.GetRY();
+    rz    [row] = info.GetRZ();
+    return;
+
+  }  // end 'SetRow(size_t, ClustInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of ClustInfo
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::SetInfos(const vector<ClustInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const ClustInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<ClustInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a ClustInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::Append(const ClustInfo& info) {
+
+    system.push_back( info.GetSystem() );
+    id    .push_back( info.GetID() );
+    nTwr  .push_back( info.GetNTwr() );
+    ene   .push_back( info.GetEne() );
+    rho   .push_back( info.GetRho() );
+    eta   .push_back( info.GetEta() );
+    phi   .push_back( info.GetPhi() );
+    px    .push_back( info.GetPX() );
+    py    .push_back( info.GetPY() );
+    pz    .push_back( info.GetPZ() );
+    rx    .push_back( info.GetRX() );
+    ry    .push_back( info.GetRY() );
+    rz    .push_back( info.GetRZ() );
+    return;
+
+  }  // end 'Append(ClustInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::Reserve(const size_t size) {
+
+    system.reserve(size);
+    id.reserve(size);
+    nTwr.reserve(size);
+    ene.reserve(size);
+    rho.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    rx.reserve(size);
+    ry.reserve(size);
+    rz.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed ClustInfo.
+   */
+  void Types::ClustColumns::Resize(const size_t size) {
+
+    system.resize(size, numeric_limits<int>::max());
+    id    .resize(size, numeric_limits<int>::max());
+    nTwr  .resize(size, numeric_limits<int64_t>::max());
+    ene   .resize(size, numeric_limits<double>::max());
+    rho   .resize(size, numeric_limits<double>::max());
+    eta   .resize(size, numeric_limits<double>::max());
+    phi   .resize(size, numeric_limits<double>::max());
+    px    .resize(size, numeric_limits<double>::max());
+    py    .resize(size, numeric_limits<double>::max());
+    pz    .resize(size, numeric_limits<double>::max());
+    rx    .resize(size, numeric_limits<double>::max());
+    ry    .resize(size, numeric_limits<double>::max());
+    rz    .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::Reset() {
+
+    system.clear();
+    id.clear();
+    nTwr.clear();
+    ene.clear();
+    rho.clear();
+    eta.clear();
+    phi.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    rx.clear();
+    ry.clear();
+    rz.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::ClustColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&ene, &rho, &eta, &phi, &px, &py, &pz, &rx, &ry, &rz}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::ClustColumns::ClustColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::ClustColumns::~ClustColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of ClustInfo
+  // --------------------------------------------------------------------------
+  Types::ClustColumns::ClustColumns(const vector<ClustInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<ClustInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
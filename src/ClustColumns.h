@@ -0,0 +1,160 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ClustColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for calorimeter cluster info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CLUSTCOLUMNS_H
+#define SCORRELATORUTILITIES_CLUSTCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "ClustInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Calorimeter cluster info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to ClustInfo:
+     *  each member of ClustInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  calorimeter clusters only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  ClustInfo. As in ClustInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class ClustColumns {
+
+      private:
+
+        // data members
+        vector<int>        system;
+        vector<int>        id;
+        vector<int64_t>    nTwr;
+        vector<Double32_t> ene;
+        vector<Double32_t> rho;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> rx;
+        vector<Double32_t> ry;
+        vector<Double32_t> rz;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as ClustInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const ClustColumns* columns = nullptr;  //!
+            size_t              index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t  GetIndex()  const {return index;}
+            int     GetSystem() const {return columns -> system[index];}
+            int     GetID()     const {return columns -> id[index];}
+            int64_t GetNTwr()   const {return columns -> nTwr[index];}
+            double  GetEne()    const {return columns -> ene[index];}
+            double  GetRho()    const {return columns -> rho[index];}
+            double  GetEta()    const {return columns -> eta[index];}
+            double  GetPhi()    const {return columns -> phi[index];}
+            double  GetPX()     const {return columns -> px[index];}
+            double  GetPY()     const {return columns -> py[index];}
+            double  GetPZ()     const {return columns -> pz[index];}
+            double  GetRX()     const {return columns -> rx[index];}
+            double  GetRY()     const {return columns -> ry[index];}
+            double  GetRZ()     const {return columns -> rz[index];}
+
+            // conversion to ClustInfo
+            ClustInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator ClustInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const ClustColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&     GetSystem() const {return system;}
+        const vector<int>&     GetID()     const {return id;}
+        const vector<int64_t>& GetNTwr()   const {return nTwr;}
+        const vector<double>&  GetEne()    const {return ene;}
+        const vector<double>&  GetRho()    const {return rho;}
+        const vector<double>&  GetEta()    const {return eta;}
+        const vector<double>&  GetPhi()    const {return phi;}
+        const vector<double>&  GetPX()     const {return px;}
+        const vector<double>&  GetPY()     const {return py;}
+        const vector<double>&  GetPZ()     const {return pz;}
+        const vector<double>&  GetRX()     const {return rx;}
+        const vector<double>&  GetRY()     const {return ry;}
+        const vector<double>&  GetRZ()     const {return rz;}
+
+        // public methods
+        size_t            GetSize() const {return system.size();}
+        bool              IsEmpty() const {return system.empty();}
+        Row               GetRow(const size_t row) const {return Row(this, row);}
+        ClustInfo         GetInfo(const size_t row) const;
+        vector<ClustInfo> GetInfos() const;
+        void              SetRow(const size_t row, const ClustInfo& info);
+        void              SetInfos(const vector<ClustInfo>& infos);
+        void              Append(const ClustInfo& info);
+        void              Reserve(const size_t size);
+        void              Resize(const size_t size);
+        void              Reset();
+        void              RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        ClustColumns();
+        ~ClustColumns();
+
+        // ctor accepting arguments
+        ClustColumns(const vector<ClustInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(ClustColumns, 2)
+
+    };  // end ClustColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
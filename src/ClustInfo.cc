@@ -151,6 +151,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::ClustInfo::RestoreLimits() {
+
+    for (double* member : {&ene, &rho, &eta, &phi, &px, &py, &pz, &rx, &ry, &rz}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #define SCORRELATORUTILITIES_CLUSTINFO_H
 
 // c++ utilities
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
@@ -46,19 +47,19 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int     system = numeric_limits<int>::max();
-        int     id     = numeric_limits<int>::max();
-        int64_t nTwr   = numeric_limits<int64_t>::max();
-        double  ene    = numeric_limits<double>::max();
-        double  rho    = numeric_limits<double>::max();
-        double  eta    = numeric_limits<double>::max();
-        double  phi    = numeric_limits<double>::max();
-        double  px     = numeric_limits<double>::max();
-        double  py     = numeric_limits<double>::max();
-        double  pz     = numeric_limits<double>::max();
-        double  rx     = numeric_limits<double>::max();
-        double  ry     = numeric_limits<double>::max();
-        double  rz     = numeric_limits<double>::max();
+        int        system = numeric_limits<int>::max();
+        int        id     = numeric_limits<int>::max();
+        int64_t    nTwr   = numeric_limits<int64_t>::max();
+        Double32_t ene    = numeric_limits<double>::max();
+        Double32_t rho    = numeric_limits<double>::max();
+        Double32_t eta    = numeric_limits<double>::max();
+        Double32_t phi    = numeric_limits<double>::max();
+        Double32_t px     = numeric_limits<double>::max();
+        Double32_t py     = numeric_limits<double>::max();
+        Double32_t pz     = numeric_limits<double>::max();
+        Double32_t rx     = numeric_limits<double>::max();
+        Double32_t ry     = numeric_limits<double>::max();
+        Double32_t rz     = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -101,6 +102,7 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(const RawCluster* clust, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> sys = nullopt);
         bool IsInAcceptance(const ClustInfo& minimum, const ClustInfo& maximum) const;
         bool IsInAcceptance(const pair<ClustInfo, ClustInfo>& range) const;
+        void RestoreLimits();
 
         // static methods
         static vector<string> GetListOfMembers();
@@ -120,7 +122,7 @@ namespace SColdQcdCorrelatorAnalysis {
         ClustInfo(const RawCluster* clust, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> sys = nullopt);
 
       // identify this class to ROOT
-      ClassDefNV(ClustInfo, 1)
+      ClassDefNV(ClustInfo, 2)
 
     };  // end ClustInfo def
 
@@ -16,8 +16,11 @@
 
 // c++ utilities
 #include <map>
+#include <array>
 #include <string>
 #include <cstdint>
+#include <utility>
+#include <string_view>
 // fastjet libraries
 #include <fastjet/JetDefinition.hh>
 #include <fastjet/AreaDefinition.hh>
@@ -53,6 +56,16 @@ namespace SColdQcdCorrelatorAnalysis {
     // ------------------------------------------------------------------------
     enum class Subset {All, Charged, Neutral};
 
+    // ------------------------------------------------------------------------
+    //! Pair weights for energy-energy correlators
+    // ------------------------------------------------------------------------
+    enum class EECWeight {Energy, Pt};
+
+    // ------------------------------------------------------------------------
+    //! Calorimeter inputs for event-level sums
+    // ------------------------------------------------------------------------
+    enum class CaloSource {Clusters, Towers};
+
     // ------------------------------------------------------------------------
     //! Object types
     // ------------------------------------------------------------------------
@@ -157,49 +170,342 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+    // tables =================================================================
+
+    // ------------------------------------------------------------------------
+    //! Table of subsystem index onto calorimeter ID
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<int, int>, 4> TableIndexOntoID = {{
+      {Subsys::EMCal, RawTowerDefs::CalorimeterId::CEMC},
+      {Subsys::RECal, RawTowerDefs::CalorimeterId::HCALIN},
+      {Subsys::IHCal, RawTowerDefs::CalorimeterId::HCALIN},
+      {Subsys::OHCal, RawTowerDefs::CalorimeterId::HCALOUT}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of subsystem index onto raw tower node names
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<int, string_view>, 4> TableIndexOntoRawTowers = {{
+      {Subsys::EMCal, "TOWER_CALIB_CEMC"},
+      {Subsys::RECal, "TOWER_CALIB_CEMC_RETOWER"},
+      {Subsys::IHCal, "TOWER_CALIB_HCALIN"},
+      {Subsys::OHCal, "TOWER_CALIB_HCALOUT"}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of subsystem index onto tower info node names
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<int, string_view>, 4> TableIndexOntoTowerInfo = {{
+      {Subsys::EMCal, "TOWERINFO_CALIB_CEMC"},
+      {Subsys::RECal, "TOWERINFO_CALIB_CEMC_RETOWER"},
+      {Subsys::IHCal, "TOWERINFO_CALIB_HCALIN"},
+      {Subsys::OHCal, "TOWERINFO_CALIB_HCALOUT"}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of subsytem index onto cluster node names
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<int, string_view>, 3> TableIndexOntoClusters = {{
+      {Subsys::EMCal, "CLUSTER_CEMC"},
+      {Subsys::IHCal, "CLUSTER_HCALIN"},
+      {Subsys::OHCal, "CLUSTER_HCALOUT"}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of subsystem index onto raw tower geometry containers
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<int, string_view>, 4> TableIndexOntoTowerGeom = {{
+      {Subsys::EMCal, "TOWERGEOM_CEMC"},
+      {Subsys::RECal, "TOWERGEOM_HCALIN"},
+      {Subsys::IHCal, "TOWERGEOM_HCALIN"},
+      {Subsys::OHCal, "TOWERGEOM_HCALOUT"}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of subsystem index onto jet source index
+    // ------------------------------------------------------------------------
+    // FIXME this might not be necessary...
+    inline constexpr array<pair<int, Jet::SRC>, 3> TableIndexOntoSrc = {{
+      {Subsys::EMCal, Jet::SRC::CEMC_CLUSTER},
+      {Subsys::IHCal, Jet::SRC::HCALIN_CLUSTER},
+      {Subsys::OHCal, Jet::SRC::HCALOUT_CLUSTER}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of RawTower jet source index onto subsystem index
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<Jet::SRC, int>, 10> TableRawTowerSrcOntoIndex = {{
+      {Jet::SRC::CEMC_TOWER, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWER_SUB1, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWER_SUB1CS, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWER_RETOWER, Subsys::RECal},
+      {Jet::SRC::HCALIN_TOWER, Subsys::IHCal},
+      {Jet::SRC::HCALIN_TOWER_SUB1, Subsys::IHCal},
+      {Jet::SRC::HCALIN_TOWER_SUB1CS, Subsys::IHCal},
+      {Jet::SRC::HCALOUT_TOWER, Subsys::OHCal},
+      {Jet::SRC::HCALOUT_TOWER_SUB1, Subsys::OHCal},
+      {Jet::SRC::HCALOUT_TOWER_SUB1CS, Subsys::OHCal}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of TowerInfo jet source index onto subsystem index
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<Jet::SRC, int>, 13> TableTowerInfoSrcOntoIndex = {{
+      {Jet::SRC::CEMC_TOWERINFO, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWERINFO_EMBED, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWERINFO_SIM, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWERINFO_SUB1, Subsys::EMCal},
+      {Jet::SRC::CEMC_TOWERINFO_RETOWER, Subsys::RECal},
+      {Jet::SRC::HCALIN_TOWERINFO, Subsys::IHCal},
+      {Jet::SRC::HCALIN_TOWERINFO_EMBED, Subsys::IHCal},
+      {Jet::SRC::HCALIN_TOWERINFO_SIM, Subsys::IHCal},
+      {Jet::SRC::HCALIN_TOWERINFO_SUB1, Subsys::IHCal},
+      {Jet::SRC::HCALOUT_TOWERINFO, Subsys::OHCal},
+      {Jet::SRC::HCALOUT_TOWERINFO_EMBED, Subsys::OHCal},
+      {Jet::SRC::HCALOUT_TOWERINFO_SIM, Subsys::OHCal},
+      {Jet::SRC::HCALOUT_TOWERINFO_SUB1, Subsys::OHCal}
+    }};
+
+    // ------------------------------------------------------------------------
+    //! Table of jet source index onto input node
+    // ------------------------------------------------------------------------
+    inline constexpr array<pair<Jet::SRC, string_view>, 31> TableSrcOntoNode = {{
+      {Jet::SRC::CEMC_CLUSTER, "CLUSTER_CEMC"},
+      {Jet::SRC::HCALIN_CLUSTER, "CLUSTER_HCALIN"},
+      {Jet::SRC::HCALOUT_CLUSTER, "CLUSTER_HCALOUT"},
+      {Jet::SRC::HCAL_TOPO_CLUSTER, "TOPOCLUSTER_HCAL"},
+      {Jet::SRC::ECAL_TOPO_CLUSTER, "TOPOCLUSTER_EMCAL"},
+      {Jet::SRC::ECAL_HCAL_TOPO_CLUSTER, "TOPOCLUSTER_ALLCALO"},
+      {Jet::SRC::CEMC_TOWER_RETOWER, "TOWER_CALIB_CEMC_RETOWER"},
+      {Jet::SRC::CEMC_TOWERINFO_RETOWER, "TOWERINFO_CALIB_CEMC_RETOWER"},
+      {Jet::SRC::CEMC_TOWER, "TOWER_CALIB_CEMC"},
+      {Jet::SRC::HCALIN_TOWER, "TOWER_CALIB_HCALIN"},
+      {Jet::SRC::HCALOUT_TOWER, "TOWER_CALIB_HCALOUT"},
+      {Jet::SRC::CEMC_TOWERINFO, "TOWERINFO_CALIB_CEMC"},
+      {Jet::SRC::HCALIN_TOWERINFO, "TOWERINFO_CALIB_HCALIN"},
+      {Jet::SRC::HCALOUT_TOWERINFO, "TOWERINFO_CALIB_HCALOUT"},
+      {Jet::SRC::CEMC_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_CEMC"},
+      {Jet::SRC::HCALIN_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_HCALIN"},
+      {Jet::SRC::HCALOUT_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_HCALOUT"},
+      {Jet::SRC::CEMC_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_CEMC"},
+      {Jet::SRC::HCALIN_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_HCALIN"},
+      {Jet::SRC::HCALOUT_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_HCALOUT"},
+      {Jet::SRC::CEMC_TOWER_SUB1, "TOWER_CALIB_CEMC_RETOWER_SUB1"},
+      {Jet::SRC::HCALIN_TOWER_SUB1, "TOWER_CALIB_HCALIN_SUB1"},
+      {Jet::SRC::HCALOUT_TOWER_SUB1, "TOWER_CALIB_HCALOUT_SUB1"},
+      {Jet::SRC::CEMC_TOWERINFO_SUB1, "TOWERINFO_CALIB_CEMC_RETOWER_SUB1"},
+      {Jet::SRC::HCALIN_TOWERINFO_SUB1, "TOWERINFO_CALIB_HCALIN_SUB1"},
+      {Jet::SRC::HCALOUT_TOWERINFO_SUB1, "TOWERINFO_CALIB_HCALOUT_SUB1"},
+      {Jet::SRC::CEMC_TOWER_SUB1CS, "TOWER_CALIB_CEMC_RETOWER_SUB1CS"},
+      {Jet::SRC::HCALIN_TOWER_SUB1CS, "TOWER_CALIB_HCALIN_SUB1CS"},
+      {Jet::SRC::HCALOUT_TOWER_SUB1CS, "TOWER_CALIB_HCALOUT_SUB1CS"},
+      {Jet::SRC::TRACK, "SvtxTrackMap"},
+      {Jet::SRC::PARTICLE, "G4TruthInfo"}
+    }};
+
+
+    // ------------------------------------------------------------------------
+    //! Table of (absolute) PID onto charge
+    // ------------------------------------------------------------------------
+    /*! Must be kept sorted by PID, since it is
+     *  binary searched (see PidOntoCharge).
+     */
+    inline constexpr array<pair<int, float>, 35> TablePidOntoCharge = {{
+      {1, -1./3.},
+      {2, 2./3.},
+      {3, -1./3.},
+      {4, 2./3.},
+      {5, -1./3.},
+      {6, 2./3.},
+      {11, -1.},
+      {12, 0.},
+      {13, -1.},
+      {14, 0.},
+      {15, -1.},
+      {16, 0.},
+      {22, 0.},
+      {23, 0.},
+      {24, 1.},
+      {111, 0.},
+      {130, 0.},
+      {211, 1.},
+      {221, 0.},
+      {310, 0.},
+      {321, 1.},
+      {421, 0.},
+      {431, 1.},
+      {441, 0.},
+      {2112, 0.},
+      {2212, 1.},
+      {3112, -1.},
+      {3122, 0.},
+      {3212, 0.},
+      {3222, 1.},
+      {3322, 0.},
+      {700201, 0.},
+      {700202, 2.},
+      {700301, 0.},
+      {700302, 3.}
+    }};
+
+
+
+    // lookups ================================================================
+
+    // ------------------------------------------------------------------------
+    //! Look up a key in a compile-time table
+    // ------------------------------------------------------------------------
+    /*! Returns the provided fallback if the key
+     *  isn't in the table. Tables are small, so
+     *  a linear scan is cheaper than hashing and
+     *  never allocates.
+     */
+    template <typename K, typename V, size_t N>
+    constexpr V LookUp(const array<pair<K, V>, N>& table, const K key, const V fallback) {
+      for (const auto& entry : table) {
+        if (entry.first == key) return entry.second;
+      }
+      return fallback;
+    }
+
+    // ------------------------------------------------------------------------
+    //! Check if a compile-time table is sorted by key
+    // ------------------------------------------------------------------------
+    template <typename K, typename V, size_t N>
+    constexpr bool IsSorted(const array<pair<K, V>, N>& table) {
+      for (size_t iEntry = 1; iEntry < N; ++iEntry) {
+        if (!(table[iEntry - 1].first < table[iEntry].first)) return false;
+      }
+      return true;
+    }
+
+    // ------------------------------------------------------------------------
+    //! Look up a key in a sorted compile-time table
+    // ------------------------------------------------------------------------
+    template <typename K, typename V, size_t N>
+    constexpr V LookUpSorted(const array<pair<K, V>, N>& table, const K key, const V fallback) {
+      size_t low  = 0;
+      size_t high = N;
+      while (low < high) {
+        const size_t mid = low + ((high - low) / 2);
+        if (table[mid].first < key) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      return ((low < N) && (table[low].first == key)) ? table[low].second : fallback;
+    }
+
+    // ------------------------------------------------------------------------
+    //! PID onto charge
+    // ------------------------------------------------------------------------
+    /*! Antiparticles take the opposite charge of
+     *  their particle. Nuclear codes (10LZZZAAAI)
+     *  which aren't in the table take a charge of
+     *  Z; any other unknown PID is taken to be
+     *  neutral. Never allocates or mutates.
+     */
+    constexpr float PidOntoCharge(const int pid) {
+      const int absPid = (pid < 0) ? -pid : pid;
+
+      float charge = 0.;
+      if (absPid >= 1000000000) {
+        charge = LookUpSorted(TablePidOntoCharge, absPid, (float) ((absPid / 10000) % 1000));
+      } else {
+        charge = LookUpSorted(TablePidOntoCharge, absPid, 0.f);
+      }
+      return (pid < 0) ? -charge : charge;
+    }
+
+    static_assert(IsSorted(TablePidOntoCharge), "TablePidOntoCharge must be sorted by PID");
+
+    // ------------------------------------------------------------------------
+    //! Subsystem index onto calorimeter ID (-1 if unknown)
+    // ------------------------------------------------------------------------
+    constexpr int IndexOntoID(const int sys) {
+      return LookUp(TableIndexOntoID, sys, -1);
+    }
+
+    // ------------------------------------------------------------------------
+    //! Subsystem index onto raw tower node name (empty if unknown)
+    // ------------------------------------------------------------------------
+    constexpr string_view IndexOntoRawTowers(const int sys) {
+      return LookUp(TableIndexOntoRawTowers, sys, string_view());
+    }
+
+    // ------------------------------------------------------------------------
+    //! Subsystem index onto tower info node name (empty if unknown)
+    // ------------------------------------------------------------------------
+    constexpr string_view IndexOntoTowerInfo(const int sys) {
+      return LookUp(TableIndexOntoTowerInfo, sys, string_view());
+    }
+
+    // ------------------------------------------------------------------------
+    //! Subsystem index onto cluster node name (empty if unknown)
+    // ------------------------------------------------------------------------
+    constexpr string_view IndexOntoClusters(const int sys) {
+      return LookUp(TableIndexOntoClusters, sys, string_view());
+    }
+
+    // ------------------------------------------------------------------------
+    //! Subsystem index onto tower geometry node name (empty if unknown)
+    // ------------------------------------------------------------------------
+    constexpr string_view IndexOntoTowerGeom(const int sys) {
+      return LookUp(TableIndexOntoTowerGeom, sys, string_view());
+    }
+
+    // ------------------------------------------------------------------------
+    //! RawTower jet source onto subsystem index (-1 if not a RawTower)
+    // ------------------------------------------------------------------------
+    constexpr int RawTowerSrcOntoIndex(const Jet::SRC src) {
+      return LookUp(TableRawTowerSrcOntoIndex, src, -1);
+    }
+
+    // ------------------------------------------------------------------------
+    //! TowerInfo jet source onto subsystem index (-1 if not a TowerInfo)
+    // ------------------------------------------------------------------------
+    constexpr int TowerInfoSrcOntoIndex(const Jet::SRC src) {
+      return LookUp(TableTowerInfoSrcOntoIndex, src, -1);
+    }
+
+    // ------------------------------------------------------------------------
+    //! Jet source onto input node name (empty if unknown)
+    // ------------------------------------------------------------------------
+    constexpr string_view SrcOntoNode(const Jet::SRC src) {
+      return LookUp(TableSrcOntoNode, src, string_view());
+    }
+
+
+
     // maps ===================================================================
 
+    // ------------------------------------------------------------------------
+    //! Build a map from a compile-time table
+    // ------------------------------------------------------------------------
+    /*! Used to back the Map* accessors below,
+     *  which are kept for callers that need to
+     *  iterate over a table. The accessors keep
+     *  their original return types (by value, or
+     *  a mutable reference for MapPidOntoCharge)
+     *  so that existing code indexing them with
+     *  operator[] still compiles; hot paths
+     *  should use the constexpr lookups instead.
+     */
+    template <typename K, typename V, typename T, size_t N>
+    map<K, V> MakeMap(const array<pair<K, T>, N>& table) {
+      map<K, V> mapToMake;
+      for (const auto& entry : table) {
+        mapToMake.emplace(entry.first, V(entry.second));
+      }
+      return mapToMake;
+    }
+
     // ------------------------------------------------------------------------
     //! Map of PID to charges
     // ------------------------------------------------------------------------
-    inline map<int, float> &MapPidOntoCharge() {
-      static map<int, float> mapPidOntoCharge = {
-        {1, -1./3.},
-        {2, 2./3.}, 
-        {3, -1./3.},
-        {4, 2./3.},
-        {5, -1./3},
-        {6, 2./3.},
-        {11, -1.},
-        {12, 0.},
-        {13, -1.},
-        {14, 0.},
-        {15, -1.},
-        {16, 0.},
-        {22, 0.},
-        {23, 0.},
-        {24, 1.},
-        {111, 0.},
-        {130, 0.},
-        {211, 1.},
-        {221, 0.},
-        {310, 0.},
-        {321, 1.},
-        {421, 0.},
-        {431, 1.},
-        {441, 1.},
-        {2112, 1.},
-        {2212, 1.},
-        {3112, -1.},
-        {3122, 0.},
-        {3212, 0.},
-        {3222, 1.},
-        {3322, 0.},
-        {700201, 0.},
-        {700202, 2.},
-        {700301, 0.},
-        {700302, 3.}
-      };
+    inline map<int, float>& MapPidOntoCharge() {
+      static map<int, float> mapPidOntoCharge = MakeMap<int, float>(TablePidOntoCharge);
       return mapPidOntoCharge;
     }
 
@@ -273,38 +579,23 @@ namespace SColdQcdCorrelatorAnalysis {
     //! Map of subsytem index onto calorimeter ID
     // ------------------------------------------------------------------------
     inline map<int, int> MapIndexOntoID() {
-      static map<int, int> mapIndexOntoID = {
-        {Subsys::EMCal, RawTowerDefs::CalorimeterId::CEMC},
-        {Subsys::RECal, RawTowerDefs::CalorimeterId::HCALIN},
-        {Subsys::IHCal, RawTowerDefs::CalorimeterId::HCALIN},
-        {Subsys::OHCal, RawTowerDefs::CalorimeterId::HCALOUT}
-      };
+      static map<int, int> mapIndexOntoID = MakeMap<int, int>(TableIndexOntoID);
       return mapIndexOntoID;
     }
 
-    // ----------------------------------------------------------------------
+    // ------------------------------------------------------------------------
     //! Map of subsystem index onto raw tower node names
-    // ----------------------------------------------------------------------
+    // ------------------------------------------------------------------------
     inline map<int, string> MapIndexOntoRawTowers() {
-      static map<int, string> mapIndexOntoRawTowers = {
-        {Subsys::EMCal, "TOWER_CALIB_CEMC"},
-        {Subsys::RECal, "TOWER_CALIB_CEMC_RETOWER"},
-        {Subsys::IHCal, "TOWER_CALIB_HCALIN"},
-        {Subsys::OHCal, "TOWER_CALIB_HCALOUT"}
-      };
+      static map<int, string> mapIndexOntoRawTowers = MakeMap<int, string>(TableIndexOntoRawTowers);
       return mapIndexOntoRawTowers;
     }
 
-    // ----------------------------------------------------------------------
+    // ------------------------------------------------------------------------
     //! Map of subsystem index onto tower info node names
-    // ----------------------------------------------------------------------
+    // ------------------------------------------------------------------------
     inline map<int, string> MapIndexOntoTowerInfo() {
-      static map<int, string> mapIndexOntoTowerInfo = {
-        {Subsys::EMCal, "TOWERINFO_CALIB_CEMC"},
-        {Subsys::RECal, "TOWERINFO_CALIB_CEMC_RETOWER"},
-        {Subsys::IHCal, "TOWERINFO_CALIB_HCALIN"},
-        {Subsys::OHCal, "TOWERINFO_CALIB_HCALOUT"}
-      };
+      static map<int, string> mapIndexOntoTowerInfo = MakeMap<int, string>(TableIndexOntoTowerInfo);
       return mapIndexOntoTowerInfo;
     }
 
@@ -312,11 +603,7 @@ namespace SColdQcdCorrelatorAnalysis {
     //! Map of subsytem index onto cluster node names
     // ------------------------------------------------------------------------
     inline map<int, string> MapIndexOntoClusters() {
-      static map<int, string> mapIndexOntoClusters = {
-        {Subsys::EMCal, "CLUSTER_CEMC"},
-        {Subsys::IHCal, "CLUSTER_HCALIN"},
-        {Subsys::OHCal, "CLUSTER_HCALOUT"}
-      };
+      static map<int, string> mapIndexOntoClusters = MakeMap<int, string>(TableIndexOntoClusters);
       return mapIndexOntoClusters;
     }
 
@@ -324,65 +611,39 @@ namespace SColdQcdCorrelatorAnalysis {
     //! Map of subsystem index onto raw tower geometry containers
     // ------------------------------------------------------------------------
     inline map<int, string> MapIndexOntoTowerGeom() {
-      static map<int, string> mapIndexOntoTowerGeom = {
-        {Subsys::EMCal, "TOWERGEOM_CEMC"},
-        {Subsys::RECal, "TOWERGEOM_HCALIN"},
-        {Subsys::IHCal, "TOWERGEOM_HCALIN"},
-        {Subsys::OHCal, "TOWERGEOM_HCALOUT"}
-      };
+      static map<int, string> mapIndexOntoTowerGeom = MakeMap<int, string>(TableIndexOntoTowerGeom);
       return mapIndexOntoTowerGeom;
     }
 
     // ------------------------------------------------------------------------
     //! Map of subsystem index onto jet source index
     // ------------------------------------------------------------------------
-    // FIXME this might not be necessary...
     inline map<int, Jet::SRC> MapIndexOntoSrc() {
-      static map<int, Jet::SRC> mapIndexOntoSrc = {
-        {Subsys::EMCal, Jet::SRC::CEMC_CLUSTER},
-        {Subsys::IHCal, Jet::SRC::HCALIN_CLUSTER},
-        {Subsys::OHCal, Jet::SRC::HCALOUT_CLUSTER}
-      };
+      static map<int, Jet::SRC> mapIndexOntoSrc = MakeMap<int, Jet::SRC>(TableIndexOntoSrc);
       return mapIndexOntoSrc;
     }
 
+    // ------------------------------------------------------------------------
+    //! Map of RawTower jet source index onto subsystem index
+    // ------------------------------------------------------------------------
+    inline const map<Jet::SRC, int>& MapRawTowerSrcOntoIndex() {
+      static const map<Jet::SRC, int> mapRawTowerSrcOntoIndex = MakeMap<Jet::SRC, int>(TableRawTowerSrcOntoIndex);
+      return mapRawTowerSrcOntoIndex;
+    }
+
+    // ------------------------------------------------------------------------
+    //! Map of TowerInfo jet source index onto subsystem index
+    // ------------------------------------------------------------------------
+    inline const map<Jet::SRC, int>& MapTowerInfoSrcOntoIndex() {
+      static const map<Jet::SRC, int> mapTowerInfoSrcOntoIndex = MakeMap<Jet::SRC, int>(TableTowerInfoSrcOntoIndex);
+      return mapTowerInfoSrcOntoIndex;
+    }
+
     // ------------------------------------------------------------------------
     //! Map of jet source index onto input node
     // ------------------------------------------------------------------------
     inline map<Jet::SRC, string> MapSrcOntoNode() {
-      static map<Jet::SRC, string> mapSrcOntoNode = {
-        {Jet::SRC::CEMC_CLUSTER, "CLUSTER_CEMC"},
-        {Jet::SRC::HCALIN_CLUSTER, "CLUSTER_HCALIN"},
-        {Jet::SRC::HCALOUT_CLUSTER, "CLUSTER_HCALOUT"},
-        {Jet::SRC::HCAL_TOPO_CLUSTER, "TOPOCLUSTER_HCAL"},
-        {Jet::SRC::ECAL_TOPO_CLUSTER, "TOPOCLUSTER_EMCAL"},
-        {Jet::SRC::ECAL_HCAL_TOPO_CLUSTER, "TOPOCLUSTER_ALLCALO"},
-        {Jet::SRC::CEMC_TOWER_RETOWER, "TOWER_CALIB_CEMC_RETOWER"},
-        {Jet::SRC::CEMC_TOWERINFO_RETOWER, "TOWERINFO_CALIB_CEMC_RETOWER"},
-        {Jet::SRC::CEMC_TOWER, "TOWER_CALIB_CEMC"},
-        {Jet::SRC::HCALIN_TOWER, "TOWER_CALIB_HCALIN"},
-        {Jet::SRC::HCALOUT_TOWER, "TOWER_CALIB_HCALOUT"},
-        {Jet::SRC::CEMC_TOWERINFO, "TOWERINFO_CALIB_CEMC"},
-        {Jet::SRC::HCALIN_TOWERINFO, "TOWERINFO_CALIB_HCALIN"},
-        {Jet::SRC::HCALOUT_TOWERINFO, "TOWERINFO_CALIB_HCALOUT"},
-        {Jet::SRC::CEMC_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_CEMC"},
-        {Jet::SRC::HCALIN_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_HCALIN"},
-        {Jet::SRC::HCALOUT_TOWERINFO_EMBED, "TOWERINFO_CALIB_EMBED_HCALOUT"},
-        {Jet::SRC::CEMC_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_CEMC"},
-        {Jet::SRC::HCALIN_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_HCALIN"},
-        {Jet::SRC::HCALOUT_TOWERINFO_SIM, "TOWERINFO_CALIB_SIM_HCALOUT"},
-        {Jet::SRC::CEMC_TOWER_SUB1, "TOWER_CALIB_CEMC_RETOWER_SUB1"},
-        {Jet::SRC::HCALIN_TOWER_SUB1, "TOWER_CALIB_HCALIN_SUB1"},
-        {Jet::SRC::HCALOUT_TOWER_SUB1, "TOWER_CALIB_HCALOUT_SUB1"},
-        {Jet::SRC::CEMC_TOWERINFO_SUB1, "TOWERINFO_CALIB_CEMC_RETOWER_SUB1"},
-        {Jet::SRC::HCALIN_TOWERINFO_SUB1, "TOWERINFO_CALIB_HCALIN_SUB1"},
-        {Jet::SRC::HCALOUT_TOWERINFO_SUB1, "TOWERINFO_CALIB_HCALOUT_SUB1"},
-        {Jet::SRC::CEMC_TOWER_SUB1CS, "TOWER_CALIB_CEMC_RETOWER_SUB1CS"},
-        {Jet::SRC::HCALIN_TOWER_SUB1CS, "TOWER_CALIB_HCALIN_SUB1CS"},
-        {Jet::SRC::HCALOUT_TOWER_SUB1CS, "TOWER_CALIB_HCALOUT_SUB1CS"},
-        {Jet::SRC::TRACK, "SvtxTrackMap"},
-        {Jet::SRC::PARTICLE, "G4TruthInfo"}
-      };
+      static map<Jet::SRC, string> mapSrcOntoNode = MakeMap<Jet::SRC, string>(TableSrcOntoNode);
       return mapSrcOntoNode;
     }
 
@@ -0,0 +1,314 @@
+/// ---------------------------------------------------------------------------
+/*! \file   CstColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for constituent info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CSTCOLUMNS_CC
+
+// class definition
+#include "CstColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a CstInfo
+  // --------------------------------------------------------------------------
+  Types::CstInfo Types::CstColumns::GetInfo(const size_t row) const {
+
+    CstInfo info;
+    info.SetType( type[row] );
+    info.SetCstID( cstID[row] );
+    info.SetJetID( jetID[row] );
+    info.SetEmbedID( embedID[row] );
+    info.SetPID( pid[row] );
+    info.SetZ( z[row] );
+    info.SetDR( dr[row] );
+    info.SetJT( jt[row] );
+    info.SetEne( ene[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetPT( pt[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of CstInfo
+  // --------------------------------------------------------------------------
+  vector<Types::CstInfo> Types::CstColumns::GetInfos() const {
+
+    vector<CstInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a CstInfo
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::SetRow(const size_t row, const CstInfo& info) {
+
+    type   [row] = info.GetType();
+    cstID  [row] = info.GetCstID();
+    jetID  [row] = info.GetJetID();
+    embedID[row] = info.GetEmbedID();
+    pid    [row] = info.GetPID();
+    z      [row] = info.GetZ();
+    dr     [row] = info.GetDR();
+    jt     [row] = info.GetJT();
+    ene    [row] = info.GetEne();
+    px     [row] = info.GetPX();
+    py     [row] = info.GetPY();
+    pz     [row] = info.GetPZ();
+    pt     [row] = info.GetPT();
+    eta    [row] = info.GetEta();
+    phi    [row] = info.GetPhi();
+    return;
+
+  }  // end 'SetRow(size_t, CstInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of CstInfo
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::SetInfos(const vector<CstInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const CstInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<CstInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a CstInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::Append(const CstInfo& info) {
+
+    type   .push_back( info.GetType() );
+    cstID  .push_back( info.GetCstID() );
+    jetID  .push_back( info.GetJetID() );
+    embedID.push_back( info.GetEmbedID() );
+    pid    .push_back( info.GetPID() );
+    z      .push_back( info.GetZ() );
+    dr     .push_back( info.GetDR() );
+    jt     .push_back( info.GetJT() );
+    ene    .push_back( info.GetEne() );
+    px     .push_back( info.GetPX() );
+    py     .push_back( info.GetPY() );
+    pz     .push_back( info.GetPZ() );
+    pt     .push_back( info.GetPT() );
+    eta    .push_back( info.GetEta() );
+    phi    .push_back( info.GetPhi() );
+    return;
+
+  }  // end 'Append(CstInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::Reserve(const size_t size) {
+
+    type.reserve(size);
+    cstID.reserve(size);
+    jetID.reserve(size);
+    embedID.reserve(size);
+    pid.reserve(size);
+    z.reserve(size);
+    dr.reserve(size);
+    jt.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed CstInfo.
+   */
+  void Types::CstColumns::Resize(const size_t size) {
+
+    type   .resize(size, numeric_limits<int>::max());
+    cstID  .resize(size, numeric_limits<int>::max());
+    jetID  .resize(size, numeric_limits<int>::max());
+    embedID.resize(size, numeric_limits<int>::max());
+    pid    .resize(size, numeric_limits<int>::max());
+    z      .resize(size, numeric_limits<double>::max());
+    dr     .resize(size, numeric_limits<double>::max());
+    jt     .resize(size, numeric_limits<double>::max());
+    ene    .resize(size, numeric_limits<double>::max());
+    px     .resize(size, numeric_limits<double>::max());
+    py     .resize(size, numeric_limits<double>::max());
+    pz     .resize(size, numeric_limits<double>::max());
+    pt     .resize(size, numeric_limits<double>::max());
+    eta    .resize(size, numeric_limits<double>::max());
+    phi    .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::Reset() {
+
+    type.clear();
+    cstID.clear();
+    jetID.clear();
+    embedID.clear();
+    pid.clear();
+    z.clear();
+    dr.clear();
+    jt.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    eta.clear();
+    phi.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&z, &dr, &jt, &ene, &px, &py, &pz, &pt, &eta, &phi}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set jet-relative kinematics for all rows
+  // --------------------------------------------------------------------------
+  void Types::CstColumns::SetJetInfo(const int id, const JetInfo& jet) {
+
+    SetJetInfo(id, jet, 0, GetSize());
+    return;
+
+  }  // end 'SetJetInfo(int, JetInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set jet-relative kinematics for a contiguous range of rows
+  // --------------------------------------------------------------------------
+  /*! Runs CstInfo::GetJetKinematics() directly
+   *  on the columns, so no gathering is needed.
+   */
+  void Types::CstColumns::SetJetInfo(
+    const int id,
+    const JetInfo& jet,
+    const size_t first,
+    const size_t nCst
+  ) {
+
+    fill(jetID.begin() + first, jetID.begin() + first + nCst, id);
+    CstInfo::GetJetKinematics(
+      jet,
+      px.data() + first,
+      py.data() + first,
+      pz.data() + first,
+      eta.data() + first,
+      phi.data() + first,
+      z.data() + first,
+      dr.data() + first,
+      jt.data() + first,
+      nCst
+    );
+    return;
+
+  }  // end 'SetJetInfo(int, JetInfo&, size_t, size_t)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::CstColumns::CstColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::CstColumns::~CstColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of CstInfo
+  // --------------------------------------------------------------------------
+  Types::CstColumns::CstColumns(const vector<CstInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<CstInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
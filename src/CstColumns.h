@@ -0,0 +1,169 @@
+/// ---------------------------------------------------------------------------
+/*! \file   CstColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for constituent info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CSTCOLUMNS_H
+#define SCORRELATORUTILITIES_CSTCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "CstInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Constituent info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to CstInfo:
+     *  each member of CstInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  jet constituents only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  CstInfo. As in CstInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class CstColumns {
+
+      private:
+
+        // data members
+        vector<int>        type;
+        vector<int>        cstID;
+        vector<int>        jetID;
+        vector<int>        embedID;
+        vector<int>        pid;
+        vector<Double32_t> z;
+        vector<Double32_t> dr;
+        vector<Double32_t> jt;
+        vector<Double32_t> ene;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> pt;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as CstInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const CstColumns* columns = nullptr;  //!
+            size_t            index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t GetIndex()   const {return index;}
+            int    GetType()    const {return columns -> type[index];}
+            int    GetCstID()   const {return columns -> cstID[index];}
+            int    GetJetID()   const {return columns -> jetID[index];}
+            int    GetEmbedID() const {return columns -> embedID[index];}
+            int    GetPID()     const {return columns -> pid[index];}
+            double GetZ()       const {return columns -> z[index];}
+            double GetDR()      const {return columns -> dr[index];}
+            double GetJT()      const {return columns -> jt[index];}
+            double GetEne()     const {return columns -> ene[index];}
+            double GetPX()      const {return columns -> px[index];}
+            double GetPY()      const {return columns -> py[index];}
+            double GetPZ()      const {return columns -> pz[index];}
+            double GetPT()      const {return columns -> pt[index];}
+            double GetEta()     const {return columns -> eta[index];}
+            double GetPhi()     const {return columns -> phi[index];}
+
+            // conversion to CstInfo
+            CstInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator CstInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const CstColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&    GetType()    const {return type;}
+        const vector<int>&    GetCstID()   const {return cstID;}
+        const vector<int>&    GetJetID()   const {return jetID;}
+        const vector<int>&    GetEmbedID() const {return embedID;}
+        const vector<int>&    GetPID()     const {return pid;}
+        const vector<double>& GetZ()       const {return z;}
+        const vector<double>& GetDR()      const {return dr;}
+        const vector<double>& GetJT()      const {return jt;}
+        const vector<double>& GetEne()     const {return ene;}
+        const vector<double>& GetPX()      const {return px;}
+        const vector<double>& GetPY()      const {return py;}
+        const vector<double>& GetPZ()      const {return pz;}
+        const vector<double>& GetPT()      const {return pt;}
+        const vector<double>& GetEta()     const {return eta;}
+        const vector<double>& GetPhi()     const {return phi;}
+
+        // public methods
+        size_t          GetSize() const {return type.size();}
+        bool            IsEmpty() const {return type.empty();}
+        Row             GetRow(const size_t row) const {return Row(this, row);}
+        CstInfo         GetInfo(const size_t row) const;
+        vector<CstInfo> GetInfos() const;
+        void            SetRow(const size_t row, const CstInfo& info);
+        void            SetInfos(const vector<CstInfo>& infos);
+        void            Append(const CstInfo& info);
+        void            Reserve(const size_t size);
+        void            Resize(const size_t size);
+        void            Reset();
+        void            RestoreLimits();
+        void            SetJetInfo(const int id, const JetInfo& jet);
+        void            SetJetInfo(const int id, const JetInfo& jet, const size_t first, const size_t nCst);
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        CstColumns();
+        ~CstColumns();
+
+        // ctor accepting arguments
+        CstColumns(const vector<CstInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(CstColumns, 2)
+
+    };  // end CstColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -157,6 +157,24 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<ROOT::Math::XYZVector> vtx
   ) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(sys, tower, context, vtx);
+    return;
+
+  }  // end 'SetInfo(int, RawTower*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A RawTower using an event context
+  // --------------------------------------------------------------------------
+  void Types::CstInfo::SetInfo(
+    const int sys,
+    RawTower* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
     // if no vertex provided, use origin
     ROOT::Math::XYZVector vtxToUse(0., 0., 0.);
     if (vtx.has_value()) {
@@ -171,7 +189,7 @@ namespace SColdQcdCorrelatorAnalysis {
       rawKey,
       sys,
       vtxToUse.z(),
-      topNode
+      context
     );
 
     // grab momentum
@@ -192,7 +210,7 @@ namespace SColdQcdCorrelatorAnalysis {
     phi   = momentum.Phi();
     return;
 
-  }  // end 'SetInfo(int, RawTower*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+  }  // end 'SetInfo(int, RawTower*, EventContext&, optional<ROOT::Math::XYZVector>)'
 
 
 
@@ -207,22 +225,39 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<ROOT::Math::XYZVector> vtx
   ) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(sys, chan, tower, context, vtx);
+    return;
+
+  }  // end 'SetInfo(int, int, TowerInfo*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A TowerInfo using an event context
+  // --------------------------------------------------------------------------
+  void Types::CstInfo::SetInfo(
+    const int sys,
+    const int chan,
+    TowerInfo* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
     // if no vertex provided, use origin
     ROOT::Math::XYZVector vtxToUse(0., 0., 0.);
     if (vtx.has_value()) {
       vtxToUse = vtx.value();
     }
 
-    // get raw tower key 
-    const auto indices = Tools::GetTowerIndices(chan, sys, topNode);
-    const int  rawKey  = Tools::GetRawTowerKey(Const::MapIndexOntoID()[ sys ], indices);
+    // grab cached geometry, indexed by channel
+    const Interfaces::TwrGeoTable& table = Interfaces::GetTwrGeoTable(sys, context);
 
     // grab position in (rho, eta, phi)
     ROOT::Math::RhoEtaPhiVector rhfPos = Tools::GetTowerPositionRhoEtaPhi(
-      rawKey,
-      sys,
-      vtxToUse.z(),
-      topNode
+      table,
+      chan,
+      vtxToUse.z()
     );
 
     // grab momentum
@@ -232,7 +267,7 @@ namespace SColdQcdCorrelatorAnalysis {
     );
 
     type  = Const::Object::Tower;
-    cstID = get<0>(indices);
+    cstID = table.towerKey[chan];
     pt    = momentum.Pt();
     px    = momentum.Px();
     py    = momentum.Py();
@@ -242,7 +277,7 @@ namespace SColdQcdCorrelatorAnalysis {
     phi   = momentum.Phi();
     return;
 
-  }  // end 'SetInfo(int, int, TowerInfo*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+  }  // end 'SetInfo(int, int, TowerInfo*, EventContext&, optional<ROOT::Math::XYZVector>)'
 
 
 
@@ -322,6 +357,24 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<int> event
   ) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(itCst, context, vtx, event);
+    return;
+
+  }  // end 'SetInfo(pair<Jet::SRC, unsigned int>&, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int> event)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A jet component iterator using an event context
+  // --------------------------------------------------------------------------
+  void Types::CstInfo::SetInfo(
+    const pair<Jet::SRC, unsigned int>& itCst,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
     // select which node to look in based on source,
     // and grab corresponding object based on
     // "index" (NOT consistent across sources)
@@ -332,7 +385,7 @@ namespace SColdQcdCorrelatorAnalysis {
         {
           SvtxTrack* track = Interfaces::FindTrack(
             itCst.second,
-            topNode
+            context
           );
           SetInfo(track);
         }
@@ -350,9 +403,9 @@ namespace SColdQcdCorrelatorAnalysis {
           RawTower* raw = Interfaces::FindRawTower(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::EMCal, raw, topNode, vtx);
+          SetInfo(Const::Subsys::EMCal, raw, context, vtx);
         }
         break;
 
@@ -362,9 +415,9 @@ namespace SColdQcdCorrelatorAnalysis {
           RawTower* raw = Interfaces::FindRawTower(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::RECal, raw, topNode, vtx);
+          SetInfo(Const::Subsys::RECal, raw, context, vtx);
         }
         break;
 
@@ -380,9 +433,9 @@ namespace SColdQcdCorrelatorAnalysis {
           RawTower* raw = Interfaces::FindRawTower(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::IHCal, raw, topNode, vtx);
+          SetInfo(Const::Subsys::IHCal, raw, context, vtx);
         }
         break;
 
@@ -398,9 +451,9 @@ namespace SColdQcdCorrelatorAnalysis {
           RawTower* raw = Interfaces::FindRawTower(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::OHCal, raw, topNode, vtx);
+          SetInfo(Const::Subsys::OHCal, raw, context, vtx);
         }
         break;
 
@@ -419,9 +472,9 @@ namespace SColdQcdCorrelatorAnalysis {
           TowerInfo* info = Interfaces::FindTowerInfo(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::EMCal, itCst.second, info, topNode, vtx);
+          SetInfo(Const::Subsys::EMCal, itCst.second, info, context, vtx);
         }
         break;
 
@@ -431,9 +484,9 @@ namespace SColdQcdCorrelatorAnalysis {
           TowerInfo* info = Interfaces::FindTowerInfo(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::RECal, itCst.second, info, topNode, vtx);
+          SetInfo(Const::Subsys::RECal, itCst.second, info, context, vtx);
         }
         break;
 
@@ -452,9 +505,9 @@ namespace SColdQcdCorrelatorAnalysis {
           TowerInfo* info = Interfaces::FindTowerInfo(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::IHCal, itCst.second, info, topNode, vtx);
+          SetInfo(Const::Subsys::IHCal, itCst.second, info, context, vtx);
         }
         break;
 
@@ -473,9 +526,9 @@ namespace SColdQcdCorrelatorAnalysis {
           TowerInfo* info = Interfaces::FindTowerInfo(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
-          SetInfo(Const::Subsys::OHCal, itCst.second, info, topNode, vtx);
+          SetInfo(Const::Subsys::OHCal, itCst.second, info, context, vtx);
         }
         break;
 
@@ -500,7 +553,7 @@ namespace SColdQcdCorrelatorAnalysis {
           RawCluster* cluster = Interfaces::FindCluster(
             itCst.second,
             itCst.first,
-            topNode
+            context
           );
           SetInfo(cluster, vtx);
         }
@@ -512,7 +565,7 @@ namespace SColdQcdCorrelatorAnalysis {
           if (event.has_value()) {
             PHG4Particle* particle = Interfaces::FindParticle(
               itCst.second,
-              topNode
+              context
             );
             SetInfo(particle, event.value());
           } else {
@@ -523,13 +576,13 @@ namespace SColdQcdCorrelatorAnalysis {
 
       // input not found, throw error
       default:
-        assert(Const::MapSrcOntoNode().find(itCst.first) != Const::MapSrcOntoNode().end());
+        assert(!Const::SrcOntoNode(itCst.first).empty());
         break;
 
     }
     return;
 
-  }  // end 'SetInfo(pair<Jet::SRC, unsigned int>&, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int> event)'
+  }  // end 'SetInfo(pair<Jet::SRC, unsigned int>&, EventContext&, optional<ROOT::Math::XYZVector>, optional<int> event)'
 
 
 
@@ -538,20 +591,9 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::CstInfo::SetJetInfo(const int id, const Types::JetInfo& jet) {
 
-    // grab 3-momenta
-    ROOT::Math::XYZVector pJet(jet.GetPX(), jet.GetPY(), jet.GetPZ());
-    ROOT::Math::XYZVector pCst(px, py, pz);
-    ROOT::Math::XYZVector pCross = pCst.Cross(pJet);
-
-    // get delta eta/phi
-    const double dEta = eta - jet.GetEta();
-    const double dPhi = phi - jet.GetPhi();
-
-    // set values and exit
+    // run batch kernel over just this constituent
     jetID = id;
-    z     = pCst.Dot(pJet) / pJet.Mag2();
-    dr    = sqrt((dEta * dEta) + (dPhi * dPhi));
-    jt    = sqrt( pCross.Mag2() ) / pJet.Mag2();
+    GetJetKinematics(jet, &px, &py, &pz, &eta, &phi, &z, &dr, &jt, 1);
     return;
 
   }  // end 'SetJetInfo(int, Types::JetInfo&)'
@@ -580,6 +622,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::CstInfo::RestoreLimits() {
+
+    for (double* member : {&z, &dr, &jt, &ene, &px, &py, &pz, &pt, &eta, &phi}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -610,6 +668,156 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Set jet-relative kinematics for a range of constituents of a jet
+  // --------------------------------------------------------------------------
+  /*! Uses a per-thread scratch buffer, so
+   *  repeated calls don't allocate once the
+   *  buffer has grown to the largest jet.
+   */
+  void Types::CstInfo::SetJetInfo(
+    const int id,
+    const Types::JetInfo& jet,
+    CstInfo* csts,
+    const size_t nCst
+  ) {
+
+    thread_local vector<double> scratch;
+    SetJetInfo(id, jet, csts, nCst, scratch);
+    return;
+
+  }  // end 'SetJetInfo(int, Types::JetInfo&, CstInfo*, size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set jet-relative kinematics for a range of constituents using a scratch buffer
+  // --------------------------------------------------------------------------
+  /*! Gathers the constituent momenta into
+   *  contiguous slices of the provided buffer
+   *  so that all of them go through
+   *  GetJetKinematics() in one loop. The
+   *  buffer only grows, so it can be reused
+   *  across jets. Results are identical to
+   *  calling SetJetInfo(int, JetInfo&) on each.
+   */
+  void Types::CstInfo::SetJetInfo(
+    const int id,
+    const Types::JetInfo& jet,
+    CstInfo* csts,
+    const size_t nCst,
+    vector<double>& scratch
+  ) {
+
+    // carve inputs & outputs out of scratch buffer
+    if (scratch.size() < (8 * nCst)) {
+      scratch.resize(8 * nCst);
+    }
+    double* pxs  = scratch.data();
+    double* pys  = pxs  + nCst;
+    double* pzs  = pys  + nCst;
+    double* etas = pzs  + nCst;
+    double* phis = etas + nCst;
+    double* zs   = phis + nCst;
+    double* drs  = zs   + nCst;
+    double* jts  = drs  + nCst;
+
+    // gather inputs
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+      pxs[iCst]  = csts[iCst].px;
+      pys[iCst]  = csts[iCst].py;
+      pzs[iCst]  = csts[iCst].pz;
+      etas[iCst] = csts[iCst].eta;
+      phis[iCst] = csts[iCst].phi;
+    }
+
+    // compute z, dr, jt in one pass
+    GetJetKinematics(jet, pxs, pys, pzs, etas, phis, zs, drs, jts, nCst);
+
+    // scatter outputs
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+      csts[iCst].jetID = id;
+      csts[iCst].z     = zs[iCst];
+      csts[iCst].dr    = drs[iCst];
+      csts[iCst].jt    = jts[iCst];
+    }
+    return;
+
+  }  // end 'SetJetInfo(int, Types::JetInfo&, CstInfo*, size_t, vector<double>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set jet-relative kinematics for a vector of constituents of a jet
+  // --------------------------------------------------------------------------
+  void Types::CstInfo::SetJetInfo(
+    const int id,
+    const Types::JetInfo& jet,
+    vector<CstInfo>& csts
+  ) {
+
+    SetJetInfo(id, jet, csts.data(), csts.size());
+    return;
+
+  }  // end 'SetJetInfo(int, Types::JetInfo&, vector<CstInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Compute z, dR, and jT wrt. a jet for arrays of constituent kinematics
+  // --------------------------------------------------------------------------
+  /*! The loop body is branch-free so that it
+   *  can be vectorized. Since both phis lie
+   *  within one period, a single shift of
+   *  2pi brings dPhi into [-pi, pi].
+   */
+  void Types::CstInfo::GetJetKinematics(
+    const Types::JetInfo& jet,
+    const double* pxs,
+    const double* pys,
+    const double* pzs,
+    const double* etas,
+    const double* phis,
+    double* zs,
+    double* drs,
+    double* jts,
+    const size_t nCst
+  ) {
+
+    // grab jet 3-momentum
+    const double pxJet  = jet.GetPX();
+    const double pyJet  = jet.GetPY();
+    const double pzJet  = jet.GetPZ();
+    const double etaJet = jet.GetEta();
+    const double phiJet = jet.GetPhi();
+    const double p2Jet  = (pxJet * pxJet) + (pyJet * pyJet) + (pzJet * pzJet);
+
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+
+      // get cst x jet
+      const double crossX = (pys[iCst] * pzJet) - (pzs[iCst] * pyJet);
+      const double crossY = (pzs[iCst] * pxJet) - (pxs[iCst] * pzJet);
+      const double crossZ = (pxs[iCst] * pyJet) - (pys[iCst] * pxJet);
+      const double cross2 = (crossX * crossX) + (crossY * crossY) + (crossZ * crossZ);
+      const double dot    = (pxs[iCst] * pxJet) + (pys[iCst] * pyJet) + (pzs[iCst] * pzJet);
+
+      // get delta eta & wrapped delta phi
+      const double dEta = etas[iCst] - etaJet;
+      double       dPhi = phis[iCst] - phiJet;
+      dPhi = (dPhi > M_PI)  ? dPhi - (2. * M_PI) : dPhi;
+      dPhi = (dPhi < -M_PI) ? dPhi + (2. * M_PI) : dPhi;
+
+      // set values
+      zs[iCst]  = dot / p2Jet;
+      drs[iCst] = sqrt((dEta * dEta) + (dPhi * dPhi));
+      jts[iCst] = sqrt(cross2) / p2Jet;
+    }
+    return;
+
+  }  // end 'GetJetKinematics(Types::JetInfo&, double*, double*, double*, double*, double*, double*, double*, double*, size_t)'
+
+
+
   // overloaded operators =====================================================
 
   // --------------------------------------------------------------------------
@@ -802,6 +1010,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A RawTower and an event context
+  // --------------------------------------------------------------------------
+  Types::CstInfo::CstInfo(
+    const int sys,
+    RawTower* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
+    SetInfo(sys, tower, context, vtx);
+
+  }  // end ctor(int, RawTower*, EventContext&, optional<ROOT::Math::XYZVector>)
+
+
+
   // --------------------------------------------------------------------------
   //! Constructor accepting a F4A TowerInfo
   // --------------------------------------------------------------------------
@@ -819,6 +1043,23 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A TowerInfo and an event context
+  // --------------------------------------------------------------------------
+  Types::CstInfo::CstInfo(
+    const int sys,
+    const int chan,
+    TowerInfo* info,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
+    SetInfo(sys, chan, info, context, vtx);
+
+  }  // end ctor(int, int, TowerInfo*, EventContext&, optional<ROOT::Math::XYZVector>)
+
+
+
   // --------------------------------------------------------------------------
   //! Constructor accepting a F4A RawCluster
   // --------------------------------------------------------------------------
@@ -855,6 +1096,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(pair<Jet::SRC, unsigned int>&, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int>)'
 
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A jet component iterator and an event context
+  // --------------------------------------------------------------------------
+  Types::CstInfo::CstInfo(
+    const pair<Jet::SRC, unsigned int>& itCst,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    SetInfo(itCst, context, vtx, event);
+
+  }  // end ctor(pair<Jet::SRC, unsigned int>&, EventContext&, optional<ROOT::Math::XYZVector>, optional<int>)'
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -68,21 +68,21 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int    type    = numeric_limits<int>::max();
-        int    cstID   = numeric_limits<int>::max();
-        int    jetID   = numeric_limits<int>::max();
-        int    embedID = numeric_limits<int>::max();
-        int    pid     = numeric_limits<int>::max();
-        double z       = numeric_limits<double>::max();
-        double dr      = numeric_limits<double>::max();
-        double jt      = numeric_limits<double>::max();
-        double ene     = numeric_limits<double>::max();
-        double px      = numeric_limits<double>::max();
-        double py      = numeric_limits<double>::max();
-        double pz      = numeric_limits<double>::max();
-        double pt      = numeric_limits<double>::max();
-        double eta     = numeric_limits<double>::max();
-        double phi     = numeric_limits<double>::max();
+        int        type    = numeric_limits<int>::max();
+        int        cstID   = numeric_limits<int>::max();
+        int        jetID   = numeric_limits<int>::max();
+        int        embedID = numeric_limits<int>::max();
+        int        pid     = numeric_limits<int>::max();
+        Double32_t z       = numeric_limits<double>::max();
+        Double32_t dr      = numeric_limits<double>::max();
+        Double32_t jt      = numeric_limits<double>::max();
+        Double32_t ene     = numeric_limits<double>::max();
+        Double32_t px      = numeric_limits<double>::max();
+        Double32_t py      = numeric_limits<double>::max();
+        Double32_t pz      = numeric_limits<double>::max();
+        Double32_t pt      = numeric_limits<double>::max();
+        Double32_t eta     = numeric_limits<double>::max();
+        Double32_t phi     = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -130,16 +130,35 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(SvtxTrack* track);
         void SetInfo(const ParticleFlowElement* flow);
         void SetInfo(const int sys, RawTower* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        void SetInfo(const int sys, RawTower* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         void SetInfo(const int sys, const int chan, TowerInfo* info, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        void SetInfo(const int sys, const int chan, TowerInfo* info, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         void SetInfo(const RawCluster* cluster, optional<ROOT::Math::XYZVector> vtx = nullopt);
         void SetInfo(PHG4Particle* particle, const int event);
         void SetInfo(const pair<Jet::SRC, unsigned int>& itCst, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+        void SetInfo(const pair<Jet::SRC, unsigned int>& itCst, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
         void SetJetInfo(const int id, const Types::JetInfo& jet);
         bool IsInAcceptance(const CstInfo& minimum, const CstInfo& maximum) const;
         bool IsInAcceptance(const pair<CstInfo, CstInfo>& range) const;
+        void RestoreLimits();
 
         // static methods
         static vector<string> GetListOfMembers();
+        static void           SetJetInfo(const int id, const Types::JetInfo& jet, CstInfo* csts, const size_t nCst);
+        static void           SetJetInfo(const int id, const Types::JetInfo& jet, CstInfo* csts, const size_t nCst, vector<double>& scratch);
+        static void           SetJetInfo(const int id, const Types::JetInfo& jet, vector<CstInfo>& csts);
+        static void           GetJetKinematics(
+          const Types::JetInfo& jet,
+          const double* pxs,
+          const double* pys,
+          const double* pzs,
+          const double* etas,
+          const double* phis,
+          double* zs,
+          double* drs,
+          double* jts,
+          const size_t nCst
+        );
 
         // overloaded operators
         friend bool operator <(const CstInfo& lhs, const CstInfo& rhs);
@@ -157,13 +176,16 @@ namespace SColdQcdCorrelatorAnalysis {
         CstInfo(SvtxTrack* track);
         CstInfo(const ParticleFlowElement* flow);
         CstInfo(const int sys, RawTower* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        CstInfo(const int sys, RawTower* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         CstInfo(const int sys, const int chan, TowerInfo* info, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        CstInfo(const int sys, const int chan, TowerInfo* info, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         CstInfo(const RawCluster* cluster, optional<ROOT::Math::XYZVector> vtx = nullopt);
         CstInfo(PHG4Particle* particle, const int event);
         CstInfo(const pair<Jet::SRC, unsigned int>& itCst, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+        CstInfo(const pair<Jet::SRC, unsigned int>& itCst, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
 
       // identify this class to ROOT
-      ClassDefNV(CstInfo, 1)
+      ClassDefNV(CstInfo, 2)
 
     };  // end CstInfo def
 
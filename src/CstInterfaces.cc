@@ -27,10 +27,40 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   SvtxTrack* Interfaces::FindTrack(const uint32_t idToFind, PHCompositeNode* topNode) {
 
-    // grab track map
-    SvtxTrackMap* map = Interfaces::GetTrackMap(topNode);
+    return FindTrack(idToFind, GetTrackMap(topNode));
 
-    // hunt down track
+  }  // end 'FindTrack(uint32_t, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find SvtxTrack based on provided ID using an event context
+  // --------------------------------------------------------------------------
+  SvtxTrack* Interfaces::FindTrack(const uint32_t idToFind, EventContext& context) {
+
+    return FindTrack(
+      idToFind,
+      context.GetTrackMap(),
+      context.GetTrackLookup()
+    );
+
+  }  // end 'FindTrack(uint32_t, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find SvtxTrack based on provided ID in a given track map
+  // --------------------------------------------------------------------------
+  SvtxTrack* Interfaces::FindTrack(const uint32_t idToFind, SvtxTrackMap* map, optional<int> event) {
+
+    // if event is identifiable, use lookup table
+    if (event.has_value() && (GetEventGeneration() > 0)) {
+      CstLookup<SvtxTrack>& lookup = GetTrackLookup();
+      lookup.SetGeneration(GetEventGeneration());
+      return FindTrack(idToFind, map, lookup);
+    }
+
+    // otherwise hunt down track
     SvtxTrack* trkToFind = nullptr;
     for (
       SvtxTrackMap::Iter itTrk = map -> begin();
@@ -50,7 +80,30 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end track loop
     return trkToFind;
 
-  }  // end 'FindTrack(uint32_t, PHCompositeNode*)'
+  }  // end 'FindTrack(uint32_t, SvtxTrackMap*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find SvtxTrack based on provided ID using a lookup table
+  // --------------------------------------------------------------------------
+  SvtxTrack* Interfaces::FindTrack(const uint32_t idToFind, SvtxTrackMap* map, CstLookup<SvtxTrack>& lookup) {
+
+    // (re)fill table if needed
+    if (!lookup.IsCurrent(map, map -> size())) {
+      lookup.Reset(map, map -> size());
+      for (
+        SvtxTrackMap::Iter itTrk = map -> begin();
+        itTrk != map -> end();
+        ++itTrk
+      ) {
+        if (!itTrk -> second) continue;
+        lookup.Add(itTrk -> second -> get_id(), itTrk -> second);
+      }
+    }
+    return lookup.Find(idToFind);
+
+  }  // end 'FindTrack(uint32_t, SvtxTrackMap*, CstLookup<SvtxTrack>&)'
 
 
 
@@ -59,10 +112,44 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   ParticleFlowElement* Interfaces::FindFlow(const uint32_t idToFind, PHCompositeNode* topNode) {
 
-    // grab pfo container
-    ParticleFlowElementContainer* flows = Interfaces::GetFlowStore(topNode);
+    return FindFlow(idToFind, GetFlowStore(topNode));
+
+  }  // end 'FindFlow(uint32_t, PHCompositeNode*)'
+
 
-    // hunt down pfo
+
+  // --------------------------------------------------------------------------
+  //! Find particle flow element based on provided ID using an event context
+  // --------------------------------------------------------------------------
+  ParticleFlowElement* Interfaces::FindFlow(const uint32_t idToFind, EventContext& context) {
+
+    return FindFlow(
+      idToFind,
+      context.GetFlowStore(),
+      context.GetFlowLookup()
+    );
+
+  }  // end 'FindFlow(uint32_t, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find PFO based on provided ID in a given container
+  // --------------------------------------------------------------------------
+  ParticleFlowElement* Interfaces::FindFlow(
+    const uint32_t idToFind,
+    ParticleFlowElementContainer* flows,
+    optional<int> event
+  ) {
+
+    // if event is identifiable, use lookup table
+    if (event.has_value() && (GetEventGeneration() > 0)) {
+      CstLookup<ParticleFlowElement>& lookup = GetFlowLookup();
+      lookup.SetGeneration(GetEventGeneration());
+      return FindFlow(idToFind, flows, lookup);
+    }
+
+    // otherwise hunt down pfo
     ParticleFlowElement* pfoToFind = nullptr;
     for (
       ParticleFlowElementContainer::ConstIterator itFlow = flows -> getParticleFlowElements().first;
@@ -82,7 +169,34 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end pfo loop
     return pfoToFind;
 
-  }  // end 'FindFlow(uint32_t, PHCompositeNode*)'
+  }  // end 'FindFlow(uint32_t, ParticleFlowElementContainer*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find PFO based on provided ID using a lookup table
+  // --------------------------------------------------------------------------
+  ParticleFlowElement* Interfaces::FindFlow(
+    const uint32_t idToFind,
+    ParticleFlowElementContainer* flows,
+    CstLookup<ParticleFlowElement>& lookup
+  ) {
+
+    // (re)fill table if needed
+    if (!lookup.IsCurrent(flows, flows -> size())) {
+      lookup.Reset(flows, flows -> size());
+      for (
+        ParticleFlowElementContainer::ConstIterator itFlow = flows -> getParticleFlowElements().first;
+        itFlow != flows -> getParticleFlowElements().second;
+        ++itFlow
+      ) {
+        if (!itFlow -> second) continue;
+        lookup.Add(itFlow -> second -> get_id(), itFlow -> second);
+      }
+    }
+    return lookup.Find(idToFind);
+
+  }  // end 'FindFlow(uint32_t, ParticleFlowElementContainer*, CstLookup<ParticleFlowElement>&)'
 
 
 
@@ -91,10 +205,52 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   RawTower* Interfaces::FindRawTower(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode) {
 
+    return FindRawTower(
+      idToFind,
+      source,
+      GetRawTowerStore(topNode, string(Const::SrcOntoNode(source)))
+    );
+
+  }  // end 'FindRawTower(uint32_t, Jet::SRC, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawTower based on provided ID and source using an event context
+  // --------------------------------------------------------------------------
+  RawTower* Interfaces::FindRawTower(const uint32_t idToFind, const Jet::SRC source, EventContext& context) {
+
+    return FindRawTower(
+      idToFind,
+      context.GetRawTowerStore(Const::SrcOntoNode(source)),
+      context.GetRawTowerLookup(source)
+    );
+
+  }  // end 'FindRawTower(uint32_t, Jet::SRC, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawTower based on provided ID in a given container
+  // --------------------------------------------------------------------------
+  RawTower* Interfaces::FindRawTower(
+    const uint32_t idToFind,
+    const Jet::SRC source,
+    RawTowerContainer* store,
+    optional<int> event
+  ) {
+
+    // if event is identifiable, use lookup table
+    if (event.has_value() && (GetEventGeneration() > 0)) {
+      CstLookup<RawTower>& lookup = GetRawTowerLookups()[source];
+      lookup.SetGeneration(GetEventGeneration());
+      return FindRawTower(idToFind, store, lookup);
+    }
+
     // grab relevant raw towers
-    RawTowerContainer::ConstRange towers = Interfaces::GetRawTowers(topNode, Const::MapSrcOntoNode()[source]);
+    RawTowerContainer::ConstRange towers = store -> getTowers();
 
-    // hunt down tower
+    // otherwise hunt down tower
     RawTower* twrToFind = nullptr;
     for (
       RawTowerContainer::ConstIterator itTwr = towers.first;
@@ -114,7 +270,32 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end tower loop
     return twrToFind;
 
-  }  // end 'FindRawTower(uint32_t, Jet::SRC, PHCompositeNode*)'
+  }  // end 'FindRawTower(uint32_t, Jet::SRC, RawTowerContainer*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawTower based on provided ID using a lookup table
+  // --------------------------------------------------------------------------
+  RawTower* Interfaces::FindRawTower(const uint32_t idToFind, RawTowerContainer* store, CstLookup<RawTower>& lookup) {
+
+    // (re)fill table if needed
+    if (!lookup.IsCurrent(store, store -> size())) {
+      RawTowerContainer::ConstRange towers = store -> getTowers();
+
+      lookup.Reset(store, store -> size());
+      for (
+        RawTowerContainer::ConstIterator itTwr = towers.first;
+        itTwr != towers.second;
+        ++itTwr
+      ) {
+        if (!itTwr -> second) continue;
+        lookup.Add(itTwr -> second -> get_id(), itTwr -> second);
+      }
+    }
+    return lookup.Find(idToFind);
+
+  }  // end 'FindRawTower(uint32_t, RawTowerContainer*, CstLookup<RawTower>&)'
 
 
 
@@ -123,26 +304,40 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   TowerInfo* Interfaces::FindTowerInfo(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode) {
 
-    // grab relevant tower info container
-    TowerInfoContainer* towers = Interfaces::GetTowerInfoStore(topNode, Const::MapSrcOntoNode()[source]);
+    EventContext context(topNode);
+    return FindTowerInfo(idToFind, source, context);
 
-    // hunt down tower
-    TowerInfo* twrToFind = nullptr;
-    for (uint32_t channel = 0; channel < towers -> size(); channel++) {
+  }  // end 'FindTowerInfo(uint32_t, Jet::SRC, PHCompositeNode*)'
 
-      // get tower
-      TowerInfo* tower = towers -> get_tower_at_channel(channel);
-      if (!tower) continue;
 
-      // check id (channel), break if found
-      if (idToFind == channel) {
-        twrToFind = tower;
-        break;
-      }
-    }  // end tower loop
-    return twrToFind;
 
-  }  // end 'FindTowerInfo(uint32_t, Jet::SRC, PHCompositeNode*)'
+  // --------------------------------------------------------------------------
+  //! Find TowerInfo based on provided ID and source using an event context
+  // --------------------------------------------------------------------------
+  TowerInfo* Interfaces::FindTowerInfo(const uint32_t idToFind, const Jet::SRC source, EventContext& context) {
+
+    // grab relevant tower info container & return tower
+    TowerInfoContainer* towers = context.GetTowerInfoStore(Const::SrcOntoNode(source));
+    return FindTowerInfo(idToFind, towers);
+
+  }  // end 'FindTowerInfo(uint32_t, Jet::SRC, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfo based on provided ID in a given container
+  // --------------------------------------------------------------------------
+  /*! TowerInfo IDs are channel numbers, so
+   *  the tower can be indexed directly.
+   */
+  TowerInfo* Interfaces::FindTowerInfo(const uint32_t idToFind, TowerInfoContainer* towers) {
+
+    if (idToFind >= towers -> size()) {
+      return nullptr;
+    }
+    return towers -> get_tower_at_channel(idToFind);
+
+  }  // end 'FindTowerInfo(uint32_t, TowerInfoContainer*)'
 
 
 
@@ -151,10 +346,52 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   RawCluster* Interfaces::FindCluster(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode) {
 
+    return FindCluster(
+      idToFind,
+      source,
+      GetClusterStore(topNode, string(Const::SrcOntoNode(source)))
+    );
+
+  }  // end 'FindCluster(uint32_t, Jet::SRC, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawCluster based on provided ID and source using an event context
+  // --------------------------------------------------------------------------
+  RawCluster* Interfaces::FindCluster(const uint32_t idToFind, const Jet::SRC source, EventContext& context) {
+
+    return FindCluster(
+      idToFind,
+      context.GetClusterStore(Const::SrcOntoNode(source)),
+      context.GetClusterLookup(source)
+    );
+
+  }  // end 'FindCluster(uint32_t, Jet::SRC, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawCluster based on provided ID in a given container
+  // --------------------------------------------------------------------------
+  RawCluster* Interfaces::FindCluster(
+    const uint32_t idToFind,
+    const Jet::SRC source,
+    RawClusterContainer* store,
+    optional<int> event
+  ) {
+
+    // if event is identifiable, use lookup table
+    if (event.has_value() && (GetEventGeneration() > 0)) {
+      CstLookup<RawCluster>& lookup = GetClusterLookups()[source];
+      lookup.SetGeneration(GetEventGeneration());
+      return FindCluster(idToFind, store, lookup);
+    }
+
     // grab relevant clusters
-    RawClusterContainer::ConstRange clusters = Interfaces::GetClusters(topNode, Const::MapSrcOntoNode()[source]);
+    RawClusterContainer::ConstRange clusters = store -> getClusters();
 
-    // hunt down cluster
+    // otherwise hunt down cluster
     RawCluster* clustToFind = nullptr;
     for (
       RawClusterContainer::ConstIterator itClust = clusters.first;
@@ -174,7 +411,32 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end cluster loop
     return clustToFind;
 
-  }  // end 'FindCluster(uint32_t, Jet::SRC, PHCompositeNode*)'
+  }  // end 'FindCluster(uint32_t, Jet::SRC, RawClusterContainer*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find RawCluster based on provided ID using a lookup table
+  // --------------------------------------------------------------------------
+  RawCluster* Interfaces::FindCluster(const uint32_t idToFind, RawClusterContainer* store, CstLookup<RawCluster>& lookup) {
+
+    // (re)fill table if needed
+    if (!lookup.IsCurrent(store, store -> size())) {
+      RawClusterContainer::ConstRange clusters = store -> getClusters();
+
+      lookup.Reset(store, store -> size());
+      for (
+        RawClusterContainer::ConstIterator itClust = clusters.first;
+        itClust != clusters.second;
+        ++itClust
+      ) {
+        if (!itClust -> second) continue;
+        lookup.Add(itClust -> second -> get_id(), itClust -> second);
+      }
+    }
+    return lookup.Find(idToFind);
+
+  }  // end 'FindCluster(uint32_t, RawClusterContainer*, CstLookup<RawCluster>&)'
 
 
 
@@ -183,10 +445,44 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   PHG4Particle* Interfaces::FindParticle(const int32_t idToFind, PHCompositeNode* topNode) {
 
-    // grab primary particles
-    PHG4TruthInfoContainer::ConstRange primaries = Interfaces::GetPrimaries(topNode);
+    return FindParticle(idToFind, GetTruthContainer(topNode));
+
+  }  // end 'FindParticle(int32_t, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find PHG4Particle based on provided ID using an event context
+  // --------------------------------------------------------------------------
+  PHG4Particle* Interfaces::FindParticle(const int32_t idToFind, EventContext& context) {
+
+    return FindParticle(
+      idToFind,
+      context.GetTruthContainer(),
+      context.GetEventSequence()
+    );
+
+  }  // end 'FindParticle(int32_t, EventContext&)'
+
 
-    // hunt down particle
+
+  // --------------------------------------------------------------------------
+  //! Find PHG4Particle based on provided ID in a given container
+  // --------------------------------------------------------------------------
+  PHG4Particle* Interfaces::FindParticle(
+    const int32_t idToFind,
+    PHG4TruthInfoContainer* container,
+    optional<int> event
+  ) {
+
+    // if event is identifiable, use particle index
+    if (event.has_value()) {
+      PHG4Particle* particle = GetPHG4ParticleIndex(container, event.value()).FindByTrackID(idToFind);
+      return (particle && container -> is_primary(particle)) ? particle : nullptr;
+    }
+
+    // otherwise hunt down particle
+    PHG4TruthInfoContainer::ConstRange primaries = container -> GetPrimaryParticleRange();
     PHG4Particle* parToFind = nullptr;
     for (
       PHG4TruthInfoContainer::ConstIterator itPar = primaries.first;
@@ -206,7 +502,196 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end particle loop
     return parToFind;
 
-  }  // end 'FindParticle(uint32_t, PHCompositeNode*)'
+  }  // end 'FindParticle(int32_t, PHG4TruthInfoContainer*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for a list of IDs from a single source
+  // --------------------------------------------------------------------------
+  vector<TowerInfo*> Interfaces::FindTowerInfos(
+    const vector<uint32_t>& idsToFind,
+    const Jet::SRC source,
+    PHCompositeNode* topNode
+  ) {
+
+    EventContext context(topNode);
+    return FindTowerInfos(idsToFind, source, context);
+
+  }  // end 'FindTowerInfos(vector<uint32_t>&, Jet::SRC, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for a list of IDs from a single source using an event context
+  // --------------------------------------------------------------------------
+  vector<TowerInfo*> Interfaces::FindTowerInfos(
+    const vector<uint32_t>& idsToFind,
+    const Jet::SRC source,
+    EventContext& context
+  ) {
+
+    // grab relevant tower info container once
+    TowerInfoContainer* towers = context.GetTowerInfoStore(Const::SrcOntoNode(source));
+
+    // and index each tower
+    vector<TowerInfo*> found;
+    found.reserve(idsToFind.size());
+    for (const uint32_t idToFind : idsToFind) {
+      found.push_back( FindTowerInfo(idToFind, towers) );
+    }
+    return found;
+
+  }  // end 'FindTowerInfos(vector<uint32_t>&, Jet::SRC, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for all constituents of a jet
+  // --------------------------------------------------------------------------
+  vector<TowerInfo*> Interfaces::FindTowerInfos(Jet* jet, PHCompositeNode* topNode) {
+
+    EventContext context(topNode);
+    return FindTowerInfos(jet, context);
+
+  }  // end 'FindTowerInfos(Jet*, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for all constituents of a jet using an event context
+  // --------------------------------------------------------------------------
+  /*! Returned vector runs parallel to the jet's
+   *  constituents; entries for non-TowerInfo
+   *  constituents are null. Containers are
+   *  resolved through the context, so each
+   *  source is looked up only once across jets.
+   */
+  vector<TowerInfo*> Interfaces::FindTowerInfos(Jet* jet, EventContext& context) {
+
+    vector<TowerInfo*> found;
+    found.reserve(jet -> size_comp());
+    for (
+      Jet::ITER_comp_vec itCst = jet -> comp_begin();
+      itCst != jet -> comp_end();
+      ++itCst
+    ) {
+
+      // skip non-TowerInfo constituents
+      const bool isTowerInfo = (Const::TowerInfoSrcOntoIndex(itCst -> first) >= 0);
+      if (!isTowerInfo) {
+        found.push_back(nullptr);
+        continue;
+      }
+
+      TowerInfoContainer* towers = context.GetTowerInfoStore(Const::SrcOntoNode(itCst -> first));
+      found.push_back( FindTowerInfo(itCst -> second, towers) );
+    }  // end constituent loop
+    return found;
+
+  }  // end 'FindTowerInfos(Jet*, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for all constituents of all jets in a container
+  // --------------------------------------------------------------------------
+  vector<vector<TowerInfo*>> Interfaces::FindTowerInfos(JetContainer* jets, PHCompositeNode* topNode) {
+
+    EventContext context(topNode);
+    return FindTowerInfos(jets, context);
+
+  }  // end 'FindTowerInfos(JetContainer*, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find TowerInfos for all constituents of all jets using an event context
+  // --------------------------------------------------------------------------
+  vector<vector<TowerInfo*>> Interfaces::FindTowerInfos(JetContainer* jets, EventContext& context) {
+
+    vector<vector<TowerInfo*>> found;
+    found.reserve(jets -> size());
+    for (uint32_t iJet = 0; iJet < jets -> size(); ++iJet) {
+      found.push_back( FindTowerInfos(jets -> get_jet(iJet), context) );
+    }
+    return found;
+
+  }  // end 'FindTowerInfos(JetContainer*, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear all process-wide constituent lookup tables
+  // --------------------------------------------------------------------------
+  /*! These tables back the finders which are
+   *  handed a container and an event sequence
+   *  number. They're keyed on the event
+   *  generation, which every EventContext
+   *  creation or reset bumps, so they never
+   *  outlive the event they were built for;
+   *  without any context on the thread, those
+   *  finders fall back to a linear search.
+   *  Calling this just frees their memory.
+   */
+  void Interfaces::ResetCstLookups() {
+
+    GetTrackLookup().Clear();
+    GetFlowLookup().Clear();
+    ResetPHG4ParticleIndex();
+    GetRawTowerLookups().clear();
+    GetClusterLookups().clear();
+    return;
+
+  }  // end 'ResetCstLookups()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) track lookup table
+  // --------------------------------------------------------------------------
+  Interfaces::CstLookup<SvtxTrack>& Interfaces::GetTrackLookup() {
+
+    thread_local CstLookup<SvtxTrack> lookup;
+    return lookup;
+
+  }  // end 'GetTrackLookup()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) PFO lookup table
+  // --------------------------------------------------------------------------
+  Interfaces::CstLookup<ParticleFlowElement>& Interfaces::GetFlowLookup() {
+
+    thread_local CstLookup<ParticleFlowElement> lookup;
+    return lookup;
+
+  }  // end 'GetFlowLookup()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) raw tower lookup tables for each source
+  // --------------------------------------------------------------------------
+  map<Jet::SRC, Interfaces::CstLookup<RawTower>>& Interfaces::GetRawTowerLookups() {
+
+    thread_local map<Jet::SRC, CstLookup<RawTower>> lookups;
+    return lookups;
+
+  }  // end 'GetRawTowerLookups()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) cluster lookup tables for each source
+  // --------------------------------------------------------------------------
+  map<Jet::SRC, Interfaces::CstLookup<RawCluster>>& Interfaces::GetClusterLookups() {
+
+    thread_local map<Jet::SRC, CstLookup<RawCluster>> lookups;
+    return lookups;
+
+  }  // end 'GetClusterLookups()'
 
 }  // end SColdQcdCorrealtorAnalysis namespace
 
@@ -11,7 +11,13 @@
 #define SCORRELATORUTILITIES_CSTINTERFACES_H
 
 // c++ utilities
+#include <map>
+#include <limits>
+#include <vector>
 #include <cassert>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
 // phool libraries
 #include <phool/phool.h>
 #include <phool/getClass.h>
@@ -36,12 +42,15 @@
 #include <particleflowreco/ParticleFlowElementContainer.h>
 // jet libraries
 #include <jetbase/Jet.h>
+#include <jetbase/JetContainer.h>
 // analysis utilities
 #include "ParInterfaces.h"
+#include "NodeInterfaces.h"
 #include "TrkInterfaces.h"
 #include "TwrInterfaces.h"
 #include "FlowInterfaces.h"
 #include "ClustInterfaces.h"
+#include "EventContext.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -54,11 +63,42 @@ namespace SColdQcdCorrelatorAnalysis {
     // cst interfaces -------------------------------------------------------
 
     SvtxTrack*           FindTrack(const uint32_t idToFind, PHCompositeNode* topNode);
+    SvtxTrack*           FindTrack(const uint32_t idToFind, EventContext& context);
+    SvtxTrack*           FindTrack(const uint32_t idToFind, SvtxTrackMap* map, optional<int> event = nullopt);
+    SvtxTrack*           FindTrack(const uint32_t idToFind, SvtxTrackMap* map, CstLookup<SvtxTrack>& lookup);
     ParticleFlowElement* FindFlow(const uint32_t idToFind, PHCompositeNode* topNode);
+    ParticleFlowElement* FindFlow(const uint32_t idToFind, EventContext& context);
+    ParticleFlowElement* FindFlow(const uint32_t idToFind, ParticleFlowElementContainer* flows, optional<int> event = nullopt);
+    ParticleFlowElement* FindFlow(const uint32_t idToFind, ParticleFlowElementContainer* flows, CstLookup<ParticleFlowElement>& lookup);
     RawTower*            FindRawTower(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode);
-    TowerInfo*           FindTowerInfo(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode);    
+    RawTower*            FindRawTower(const uint32_t idToFind, const Jet::SRC source, EventContext& context);
+    RawTower*            FindRawTower(const uint32_t idToFind, const Jet::SRC source, RawTowerContainer* store, optional<int> event = nullopt);
+    RawTower*            FindRawTower(const uint32_t idToFind, RawTowerContainer* store, CstLookup<RawTower>& lookup);
+    TowerInfo*           FindTowerInfo(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode);
+    TowerInfo*           FindTowerInfo(const uint32_t idToFind, const Jet::SRC source, EventContext& context);
+    TowerInfo*           FindTowerInfo(const uint32_t idToFind, TowerInfoContainer* towers);
     RawCluster*          FindCluster(const uint32_t idToFind, const Jet::SRC source, PHCompositeNode* topNode);
+    RawCluster*          FindCluster(const uint32_t idToFind, const Jet::SRC source, EventContext& context);
+    RawCluster*          FindCluster(const uint32_t idToFind, const Jet::SRC source, RawClusterContainer* store, optional<int> event = nullopt);
+    RawCluster*          FindCluster(const uint32_t idToFind, RawClusterContainer* store, CstLookup<RawCluster>& lookup);
     PHG4Particle*        FindParticle(const int32_t idToFind, PHCompositeNode* topNode);
+    PHG4Particle*        FindParticle(const int32_t idToFind, EventContext& context);
+    PHG4Particle*        FindParticle(const int32_t idToFind, PHG4TruthInfoContainer* container, optional<int> event = nullopt);
+
+    // batched tower info resolution
+    vector<TowerInfo*>         FindTowerInfos(const vector<uint32_t>& idsToFind, const Jet::SRC source, PHCompositeNode* topNode);
+    vector<TowerInfo*>         FindTowerInfos(const vector<uint32_t>& idsToFind, const Jet::SRC source, EventContext& context);
+    vector<TowerInfo*>         FindTowerInfos(Jet* jet, PHCompositeNode* topNode);
+    vector<TowerInfo*>         FindTowerInfos(Jet* jet, EventContext& context);
+    vector<vector<TowerInfo*>> FindTowerInfos(JetContainer* jets, PHCompositeNode* topNode);
+    vector<vector<TowerInfo*>> FindTowerInfos(JetContainer* jets, EventContext& context);
+
+    // process-wide (per-thread) lookup tables
+    void                                  ResetCstLookups();
+    CstLookup<SvtxTrack>&                 GetTrackLookup();
+    CstLookup<ParticleFlowElement>&       GetFlowLookup();
+    map<Jet::SRC, CstLookup<RawTower>>&   GetRawTowerLookups();
+    map<Jet::SRC, CstLookup<RawCluster>>& GetClusterLookups();
 
   }  // end Interfaces namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
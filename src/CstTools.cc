@@ -0,0 +1,264 @@
+/// ---------------------------------------------------------------------------
+/*! \file   CstTools.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Collection of frequent jet constituent-related methods utilized
+ *  in the sPHENIX Cold QCD Energy-Energy Correlator analysis.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CSTTOOLS_CC
+
+// namespace definition
+#include "CstTools.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+// constituent methods ========================================================
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of a jet
+  // --------------------------------------------------------------------------
+  vector<Types::CstInfo> Tools::GetCstInfos(
+    Jet* jet,
+    PHCompositeNode* topNode,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    Interfaces::EventContext context(topNode);
+    return GetCstInfos(jet, context, vtx, event);
+
+  }  // end 'GetCstInfos(Jet*, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of a jet using an event context
+  // --------------------------------------------------------------------------
+  vector<Types::CstInfo> Tools::GetCstInfos(
+    Jet* jet,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    const vector<Jet*> jets = {jet};
+    return GetCstInfos(jets, context, vtx, event).front();
+
+  }  // end 'GetCstInfos(Jet*, EventContext&, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of all jets in a container
+  // --------------------------------------------------------------------------
+  vector<vector<Types::CstInfo>> Tools::GetCstInfos(
+    JetContainer* jets,
+    PHCompositeNode* topNode,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    Interfaces::EventContext context(topNode);
+    return GetCstInfos(jets, context, vtx, event);
+
+  }  // end 'GetCstInfos(JetContainer*, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of all jets in a container using an event context
+  // --------------------------------------------------------------------------
+  vector<vector<Types::CstInfo>> Tools::GetCstInfos(
+    JetContainer* jets,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    vector<Jet*> jetList;
+    jetList.reserve(jets -> size());
+    for (uint32_t iJet = 0; iJet < jets -> size(); ++iJet) {
+      jetList.push_back( jets -> get_jet(iJet) );
+    }
+    return GetCstInfos(jetList, context, vtx, event);
+
+  }  // end 'GetCstInfos(JetContainer*, EventContext&, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of a list of jets
+  // --------------------------------------------------------------------------
+  vector<vector<Types::CstInfo>> Tools::GetCstInfos(
+    const vector<Jet*>& jets,
+    PHCompositeNode* topNode,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    Interfaces::EventContext context(topNode);
+    return GetCstInfos(jets, context, vtx, event);
+
+  }  // end 'GetCstInfos(vector<Jet*>&, PHCompositeNode*, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get info for all constituents of a list of jets using an event context
+  // --------------------------------------------------------------------------
+  /*! Constituents are grouped by source so that
+   *  each input container is resolved only once,
+   *  and jet-relative quantities (z, dr, jt) are
+   *  filled in the same pass. The returned infos
+   *  run parallel to each jet's constituents.
+   *  Constituents which can't be found are left
+   *  in their default (maximized) state.
+   */
+  vector<vector<Types::CstInfo>> Tools::GetCstInfos(
+    const vector<Jet*>& jets,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx,
+    optional<int> event
+  ) {
+
+    // group constituents by source: (jet index, cst index, object id)
+    map<Jet::SRC, vector<tuple<size_t, size_t, uint32_t>>> groups;
+
+    // collect jet info & groupings
+    vector<Types::JetInfo>         jetInfos(jets.size());
+    vector<vector<Types::CstInfo>> cstInfos(jets.size());
+    for (size_t iJet = 0; iJet < jets.size(); ++iJet) {
+
+      jetInfos[iJet].SetInfo( *(jets[iJet]) );
+      cstInfos[iJet].resize( jets[iJet] -> size_comp() );
+
+      size_t iCst = 0;
+      for (
+        Jet::ITER_comp_vec itCst = jets[iJet] -> comp_begin();
+        itCst != jets[iJet] -> comp_end();
+        ++itCst, ++iCst
+      ) {
+        groups[itCst -> first].emplace_back(iJet, iCst, itCst -> second);
+      }
+    }  // end jet loop
+
+    // grab event sequence once
+    const optional<int> sequence = context.GetEventSequence();
+
+    // now resolve each source's container once and fill infos
+    for (const auto& [source, members] : groups) {
+      switch (source) {
+
+        // SvtxTrack
+        case Jet::SRC::TRACK:
+          {
+            SvtxTrackMap* tracks = context.GetTrackMap();
+            for (const auto& [iJet, iCst, id] : members) {
+              SvtxTrack* track = Interfaces::FindTrack(id, tracks, context.GetTrackLookup());
+              if (!track) continue;
+
+              Types::CstInfo& cst = cstInfos[iJet][iCst];
+              cst.SetInfo(track);
+              cst.SetJetInfo(jets[iJet] -> get_id(), jetInfos[iJet]);
+            }
+          }
+          break;
+
+        // RawCluster
+        case Jet::SRC::CEMC_CLUSTER:
+          [[fallthrough]];
+
+        case Jet::SRC::HCALIN_CLUSTER:
+          [[fallthrough]];
+
+        case Jet::SRC::HCALOUT_CLUSTER:
+          [[fallthrough]];
+
+        case Jet::SRC::HCAL_TOPO_CLUSTER:
+          [[fallthrough]];
+
+        case Jet::SRC::ECAL_TOPO_CLUSTER:
+          [[fallthrough]];
+
+        case Jet::SRC::ECAL_HCAL_TOPO_CLUSTER:
+          {
+            RawClusterContainer* store = context.GetClusterStore(Const::SrcOntoNode(source));
+            for (const auto& [iJet, iCst, id] : members) {
+              RawCluster* cluster = Interfaces::FindCluster(id, store, context.GetClusterLookup(source));
+              if (!cluster) continue;
+
+              Types::CstInfo& cst = cstInfos[iJet][iCst];
+              cst.SetInfo(cluster, vtx);
+              cst.SetJetInfo(jets[iJet] -> get_id(), jetInfos[iJet]);
+            }
+          }
+          break;
+
+        // PHG4Particle
+        case Jet::SRC::PARTICLE:
+          {
+            // particles can't be resolved without an embedding ID,
+            // so leave them in their default state
+            if (!event.has_value()) {
+              assert(event.has_value());
+              break;
+            }
+
+            PHG4TruthInfoContainer* container = context.GetTruthContainer();
+            for (const auto& [iJet, iCst, id] : members) {
+              PHG4Particle* particle = Interfaces::FindParticle(id, container, sequence);
+              if (!particle) continue;
+
+              Types::CstInfo& cst = cstInfos[iJet][iCst];
+              cst.SetInfo(particle, event.value());
+              cst.SetJetInfo(jets[iJet] -> get_id(), jetInfos[iJet]);
+            }
+          }
+          break;
+
+        // RawTower or TowerInfo
+        default:
+          if (Const::RawTowerSrcOntoIndex(source) >= 0) {
+            const int          sys   = Const::RawTowerSrcOntoIndex(source);
+            RawTowerContainer* store = context.GetRawTowerStore(Const::SrcOntoNode(source));
+            for (const auto& [iJet, iCst, id] : members) {
+              RawTower* raw = Interfaces::FindRawTower(id, store, context.GetRawTowerLookup(source));
+              if (!raw) continue;
+
+              Types::CstInfo& cst = cstInfos[iJet][iCst];
+              cst.SetInfo(sys, raw, context, vtx);
+              cst.SetJetInfo(jets[iJet] -> get_id(), jetInfos[iJet]);
+            }
+          } else if (Const::TowerInfoSrcOntoIndex(source) >= 0) {
+            const int           sys    = Const::TowerInfoSrcOntoIndex(source);
+            TowerInfoContainer* towers = context.GetTowerInfoStore(Const::SrcOntoNode(source));
+            for (const auto& [iJet, iCst, id] : members) {
+              TowerInfo* info = Interfaces::FindTowerInfo(id, towers);
+              if (!info) continue;
+
+              Types::CstInfo& cst = cstInfos[iJet][iCst];
+              cst.SetInfo(sys, id, info, context, vtx);
+              cst.SetJetInfo(jets[iJet] -> get_id(), jetInfos[iJet]);
+            }
+          } else {
+            assert(!Const::SrcOntoNode(source).empty());
+          }
+          break;
+
+      }  // end switch (source)
+    }  // end source loop
+    return cstInfos;
+
+  }  // end 'GetCstInfos(vector<Jet*>&, EventContext&, optional<ROOT::Math::XYZVector>, optional<int>)'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
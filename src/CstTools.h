@@ -0,0 +1,55 @@
+/// ---------------------------------------------------------------------------
+/*! \file   CstTools.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Collection of frequent jet constituent-related methods utilized
+ *  in the sPHENIX Cold QCD Energy-Energy Correlator analysis.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CSTTOOLS_H
+#define SCORRELATORUTILITIES_CSTTOOLS_H
+
+// c++ utilities
+#include <map>
+#include <tuple>
+#include <vector>
+#include <cassert>
+#include <optional>
+// root libraries
+#include <Math/Vector3D.h>
+// phool libraries
+#include <phool/PHCompositeNode.h>
+// jetbase libraries
+#include <jetbase/Jet.h>
+#include <jetbase/JetContainer.h>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "Constants.h"
+#include "Interfaces.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Tools {
+
+    // constituent methods ----------------------------------------------------
+
+    vector<Types::CstInfo>         GetCstInfos(Jet* jet, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+    vector<Types::CstInfo>         GetCstInfos(Jet* jet, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+    vector<vector<Types::CstInfo>> GetCstInfos(JetContainer* jets, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+    vector<vector<Types::CstInfo>> GetCstInfos(JetContainer* jets, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+    vector<vector<Types::CstInfo>> GetCstInfos(const vector<Jet*>& jets, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+    vector<vector<Types::CstInfo>> GetCstInfos(const vector<Jet*>& jets, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt, optional<int> event = nullopt);
+
+  }  // end Tools namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
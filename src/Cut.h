@@ -0,0 +1,232 @@
+/// ---------------------------------------------------------------------------
+/*! \file   Cut.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Field-selective acceptance cuts for the
+ *  utility types.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CUT_H
+#define SCORRELATORUTILITIES_CUT_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Acceptance cut on a subset of fields of an info type
+    // ------------------------------------------------------------------------
+    /*! Unlike IsInAcceptance(), which compares
+     *  every member against a full minimum and
+     *  maximum object, only the fields which are
+     *  added are checked, e.g.
+     *
+     *    Cut<TrkInfo> cut;
+     *    cut.Add(&TrkInfo::GetPT, 0.2, 100.)
+     *       .Add(&TrkInfo::GetEta, -1.1, 1.1);
+     *    const bool isGood = cut.Pass(track);
+     *
+     *  Fields are stored as plain (getter, lo, hi)
+     *  entries and checked in a direct loop. A
+     *  getter may return any arithmetic type; its
+     *  value is compared as a double. Bounds are
+     *  inclusive, as in IsInAcceptance(). The
+     *  check stops at the first failing field.
+     */
+    template <typename T> class Cut {
+
+      // every pointer to a const member function of T has the same size
+      typedef double (T::*Getter)() const;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! A (getter, lo, hi) entry
+        // --------------------------------------------------------------------
+        /*! The getter is kept as raw bytes along
+         *  with a thunk which knows its return
+         *  type, so getters of any arithmetic
+         *  type share one list.
+         */
+        struct Entry {
+          unsigned char get[sizeof(Getter)];
+          double (*value)(const T&, const void*);
+          double lo;
+          double hi;
+        };
+
+      private:
+
+        // data members
+        vector<Entry> tests;
+
+        // helper methods
+        template <typename R> static double Value(const T& object, const void* get) {
+          R (T::*getter)() const;
+          memcpy(&getter, get, sizeof(getter));
+          return static_cast<double>((object.*getter)());
+        }
+        static bool Test(const Entry& entry, const T& object) {
+          const double value = entry.value(object, entry.get);
+          return ((value >= entry.lo) && (value <= entry.hi));
+        }
+
+      public:
+
+        // getters
+        size_t GetNFields() const {return tests.size();}
+
+        // public methods
+        template <typename R> Cut& Add(R (T::*getter)() const, const double lo, const double hi) {
+          static_assert(is_arithmetic_v<R>, "Cut fields must be arithmetic");
+          static_assert(sizeof(getter) == sizeof(Getter), "unexpected member function pointer size");
+          Entry entry;
+          memcpy(entry.get, &getter, sizeof(getter));
+          entry.value = &Value<R>;
+          entry.lo    = lo;
+          entry.hi    = hi;
+          tests.push_back(entry);
+          return *this;
+        }
+        template <typename R> Cut& AddMin(R (T::*getter)() const, const double lo) {
+          return Add(getter, lo, numeric_limits<double>::infinity());
+        }
+        template <typename R> Cut& AddMax(R (T::*getter)() const, const double hi) {
+          return Add(getter, -numeric_limits<double>::infinity(), hi);
+        }
+        void Reset() {
+          tests.clear();
+        }
+        bool Pass(const T& object) const {
+          for (const Entry& entry : tests) {
+            if (!Test(entry, object)) return false;
+          }
+          return true;
+        }
+        void Pass(const T* objects, uint8_t* mask, const size_t nObj) const {
+          fill(mask, mask + nObj, 1);
+          for (const Entry& entry : tests) {
+            for (size_t iObj = 0; iObj < nObj; ++iObj) {
+              mask[iObj] &= Test(entry, objects[iObj]);
+            }
+          }
+        }
+        vector<uint8_t> Pass(const vector<T>& objects) const {
+          vector<uint8_t> mask(objects.size());
+          Pass(objects.data(), mask.data(), objects.size());
+          return mask;
+        }
+
+    };  // end Cut def
+
+
+
+    // ------------------------------------------------------------------------
+    //! Acceptance cut on a subset of columns of a column-wise container
+    // ------------------------------------------------------------------------
+    /*! Column-wise counterpart of Cut<T>, for
+     *  e.g. TrkColumns. Each added field is
+     *  checked over its whole column in one
+     *  tight loop, e.g.
+     *
+     *    ColumnCut<TrkColumns> cut;
+     *    cut.Add(&TrkColumns::GetPT, 0.2, 100.);
+     *    vector<uint8_t> mask = cut.Pass(tracks);
+     *
+     *  As with Cut<T>, columns of any arithmetic
+     *  type are accepted; the thunk stored with
+     *  each entry runs the loop over the column's
+     *  own type.
+     */
+    template <typename T> class ColumnCut {
+
+      // every pointer to a const member function of T has the same size
+      typedef const vector<double>& (T::*Getter)() const;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! A (column getter, lo, hi) entry
+        // --------------------------------------------------------------------
+        struct Entry {
+          unsigned char get[sizeof(Getter)];
+          void (*test)(const T&, const void*, const double, const double, uint8_t*);
+          double lo;
+          double hi;
+        };
+
+      private:
+
+        // data members
+        vector<Entry> tests;
+
+        // helper methods
+        template <typename R> static void Test(const T& columns, const void* get, const double lo, const double hi, uint8_t* mask) {
+          const vector<R>& (T::*getter)() const;
+          memcpy(&getter, get, sizeof(getter));
+
+          const vector<R>& values = (columns.*getter)();
+          const R*         value  = values.data();
+          const size_t     nRow   = values.size();
+          for (size_t row = 0; row < nRow; ++row) {
+            mask[row] &= ((value[row] >= lo) && (value[row] <= hi));
+          }
+        }
+
+      public:
+
+        // getters
+        size_t GetNFields() const {return tests.size();}
+
+        // public methods
+        template <typename R> ColumnCut& Add(const vector<R>& (T::*column)() const, const double lo, const double hi) {
+          static_assert(is_arithmetic_v<R>, "ColumnCut columns must be arithmetic");
+          static_assert(sizeof(column) == sizeof(Getter), "unexpected member function pointer size");
+          Entry entry;
+          memcpy(entry.get, &column, sizeof(column));
+          entry.test = &Test<R>;
+          entry.lo   = lo;
+          entry.hi   = hi;
+          tests.push_back(entry);
+          return *this;
+        }
+        template <typename R> ColumnCut& AddMin(const vector<R>& (T::*column)() const, const double lo) {
+          return Add(column, lo, numeric_limits<double>::infinity());
+        }
+        template <typename R> ColumnCut& AddMax(const vector<R>& (T::*column)() const, const double hi) {
+          return Add(column, -numeric_limits<double>::infinity(), hi);
+        }
+        void Reset() {
+          tests.clear();
+        }
+        vector<uint8_t> Pass(const T& columns) const {
+          vector<uint8_t> mask(columns.GetSize(), 1);
+          for (const Entry& entry : tests) {
+            entry.test(columns, entry.get, entry.lo, entry.hi, mask.data());
+          }
+          return mask;
+        }
+
+    };  // end ColumnCut def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,388 @@
+/// ---------------------------------------------------------------------------
+/*! \file   EECEngine.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Pair loop to fill two-point energy-energy
+ *  correlators from jet constituents.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_EECENGINE_CC
+
+// class definition
+#include "EECEngine.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // private methods ==========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a selected constituent into the scratch arrays
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Select(
+    const double wgt,
+    const double eta,
+    const double phi,
+    const int type,
+    const int pid
+  ) {
+
+    if (!IsInSubset(subset, type, pid)) return;
+
+    cstWgts.push_back(wgt);
+    cstEtas.push_back(eta);
+    cstPhis.push_back(phi);
+    return;
+
+  }  // end 'Select(double, double, double, int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Run blocked pair loop over selected constituents
+  // --------------------------------------------------------------------------
+  /*! Pairs (i, j > i) are visited in square
+   *  blocks of blockSize x blockSize so that
+   *  both rows stay in cache. For each i, the
+   *  R_L^2 and weights of its pairs in the
+   *  current block are computed first, without
+   *  any libm calls, then log(R_L) is taken and
+   *  the weights are summed per bin.
+   *  The jet is added once all pairs are in.
+   */
+  void Types::EECEngine::FillPairs(const double norm) {
+
+    const size_t    nCst = cstWgts.size();
+    const HistAxis& axis = hist.GetXAxis();
+    pairRL2.resize(blockSize);
+    pairWgts.resize(blockSize);
+    jetW.assign(axis.GetNBins() + 2, 0.);
+
+    for (size_t iBlock = 0; iBlock < nCst; iBlock += blockSize) {
+      const size_t iEnd = min(iBlock + blockSize, nCst);
+      for (size_t jBlock = iBlock; jBlock < nCst; jBlock += blockSize) {
+        const size_t jEnd = min(jBlock + blockSize, nCst);
+        for (size_t iCst = iBlock; iCst < iEnd; ++iCst) {
+
+          const size_t jStart = max(jBlock, iCst + 1);
+          if (jStart >= jEnd) continue;
+
+          // compute pair quantities
+          const size_t nPair = jEnd - jStart;
+          const double wgtI  = cstWgts[iCst] * norm;
+          const double etaI  = cstEtas[iCst];
+          const double phiI  = cstPhis[iCst];
+          const double* wgtJ = cstWgts.data() + jStart;
+          const double* etaJ = cstEtas.data() + jStart;
+          const double* phiJ = cstPhis.data() + jStart;
+          for (size_t iPair = 0; iPair < nPair; ++iPair) {
+            const double dEta = etaI - etaJ[iPair];
+            double       dPhi = phiI - phiJ[iPair];
+            dPhi = (dPhi > M_PI)  ? dPhi - (2. * M_PI) : dPhi;
+            dPhi = (dPhi < -M_PI) ? dPhi + (2. * M_PI) : dPhi;
+            pairRL2[iPair]  = (dEta * dEta) + (dPhi * dPhi);
+            pairWgts[iPair] = wgtI * wgtJ[iPair];
+          }
+
+          // then bin them on log(R_L)
+          for (size_t iPair = 0; iPair < nPair; ++iPair) {
+            jetW[axis.GetBinFromCoordinate(0.5 * log10(pairRL2[iPair]))] += pairWgts[iPair];
+          }
+        }  // end i loop
+      }  // end j block loop
+    }  // end i block loop
+
+    if (nCst > 1) nPairs += (nCst * (nCst - 1)) / 2;
+    AddJet();
+    return;
+
+  }  // end 'FillPairs(double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add the current jet's bins to the accumulator
+  // --------------------------------------------------------------------------
+  /*! Each bin is filled once per jet, so the
+   *  errors are those of the per-jet sums, and
+   *  the jet counts as one entry.
+   */
+  void Types::EECEngine::AddJet() {
+
+    hist.FillContents(jetW.data());
+    if (hist.GetNReplicas() > 0) {
+      hist.FillReplicas(jetW.data(), repWgts.data());
+    }
+    ++nJets;
+    return;
+
+  }  // end 'AddJet()'
+
+
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear accumulated jets
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Reset() {
+
+    hist.Reset();
+    nJets  = 0;
+    nPairs = 0;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add jets accumulated by another engine (e.g. on another thread)
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Add(const EECEngine& other) {
+
+    hist.Add(other.hist);
+    nJets  += other.nJets;
+    nPairs += other.nPairs;
+    return;
+
+  }  // end 'Add(EECEngine&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Turn on (or off, for 0) bootstrap replicas
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::SetNReplicas(const size_t replicas) {
+
+    hist.SetNReplicas(replicas);
+    repWgts.assign(replicas, 1.);
+    return;
+
+  }  // end 'SetNReplicas(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set replica weights for the current event
+  // --------------------------------------------------------------------------
+  /*! E.g. from BootstrapWeights::GetWeights().
+   *  These are applied to every jet filled
+   *  until they're set again.
+   */
+  void Types::EECEngine::SetReplicaWeights(const vector<double>& wgts) {
+
+    if (wgts.size() != repWgts.size()) {
+      cerr << PHWHERE << "PANIC: got " << wgts.size() << " replica weights for " << repWgts.size() << " replicas!" << endl;
+      assert(wgts.size() == repWgts.size());
+    }
+
+    repWgts = wgts;
+    return;
+
+  }  // end 'SetReplicaWeights(vector<double>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add pairs from a jet's constituents
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Fill(
+    const JetInfo& jet,
+    const vector<CstInfo>& csts,
+    const double evtWeight
+  ) {
+
+    // gather selected constituents
+    cstWgts.clear();
+    cstEtas.clear();
+    cstPhis.clear();
+    for (const CstInfo& cst : csts) {
+      Select(
+        (weight == Const::EECWeight::Pt) ? cst.GetPT() : cst.GetEne(),
+        cst.GetEta(),
+        cst.GetPhi(),
+        cst.GetType(),
+        cst.GetPID()
+      );
+    }
+
+    // normalize by jet energy (or pt) squared
+    const double wgtJet = (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne();
+    FillPairs(evtWeight / (wgtJet * wgtJet));
+    return;
+
+  }  // end 'Fill(JetInfo&, vector<CstInfo>&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add pairs from a jet's constituents stored column-wise
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Fill(
+    const JetInfo& jet,
+    const CstColumns& csts,
+    const double evtWeight
+  ) {
+
+    Fill(jet, csts, 0, csts.GetSize(), evtWeight);
+    return;
+
+  }  // end 'Fill(JetInfo&, CstColumns&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add pairs from a contiguous range of constituents stored column-wise
+  // --------------------------------------------------------------------------
+  void Types::EECEngine::Fill(
+    const JetInfo& jet,
+    const CstColumns& csts,
+    const size_t first,
+    const size_t nCst,
+    const double evtWeight
+  ) {
+
+    // grab relevant columns
+    const vector<double>& wgts  = (weight == Const::EECWeight::Pt) ? csts.GetPT() : csts.GetEne();
+    const vector<double>& etas  = csts.GetEta();
+    const vector<double>& phis  = csts.GetPhi();
+    const vector<int>&    types = csts.GetType();
+    const vector<int>&    pids  = csts.GetPID();
+
+    // gather selected constituents
+    cstWgts.clear();
+    cstEtas.clear();
+    cstPhis.clear();
+    for (size_t iCst = first; iCst < first + nCst; ++iCst) {
+      Select(wgts[iCst], etas[iCst], phis[iCst], types[iCst], pids[iCst]);
+    }
+
+    // normalize by jet energy (or pt) squared
+    const double wgtJet = (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne();
+    FillPairs(evtWeight / (wgtJet * wgtJet));
+    return;
+
+  }  // end 'Fill(JetInfo&, CstColumns&, size_t, size_t, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add pairs from a jet's constituents with a naive double loop
+  // --------------------------------------------------------------------------
+  /*! Reference implementation to validate the
+   *  blocked loop against: results should agree
+   *  up to the order of summation.
+   */
+  void Types::EECEngine::FillReference(
+    const JetInfo& jet,
+    const vector<CstInfo>& csts,
+    const double evtWeight
+  ) {
+
+    const double wgtJet = (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne();
+    jetW.assign(hist.GetXAxis().GetNBins() + 2, 0.);
+    for (size_t iCst = 0; iCst < csts.size(); ++iCst) {
+      if (!IsInSubset(subset, csts[iCst].GetType(), csts[iCst].GetPID())) continue;
+
+      for (size_t jCst = iCst + 1; jCst < csts.size(); ++jCst) {
+        if (!IsInSubset(subset, csts[jCst].GetType(), csts[jCst].GetPID())) continue;
+
+        // get weights
+        const double wgtI = (weight == Const::EECWeight::Pt) ? csts[iCst].GetPT() : csts[iCst].GetEne();
+        const double wgtJ = (weight == Const::EECWeight::Pt) ? csts[jCst].GetPT() : csts[jCst].GetEne();
+        const double wgt  = (wgtI * wgtJ * evtWeight) / (wgtJet * wgtJet);
+
+        // get distance
+        const double dEta = csts[iCst].GetEta() - csts[jCst].GetEta();
+        const double dPhi = remainder(csts[iCst].GetPhi() - csts[jCst].GetPhi(), 2. * M_PI);
+        const double rl   = sqrt((dEta * dEta) + (dPhi * dPhi));
+
+        // and add to jet's bins
+        jetW[hist.GetXAxis().GetBin(rl)] += wgt;
+        ++nPairs;
+      }
+    }  // end constituent loop
+
+    AddJet();
+    return;
+
+  }  // end 'FillReference(JetInfo&, vector<CstInfo>&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Create a histogram of the accumulated correlator
+  // --------------------------------------------------------------------------
+  /*! The caller takes ownership of the
+   *  returned histogram.
+   */
+  TH1D* Types::EECEngine::MakeHistogram(const string& name, const string& title) const {
+
+    return hist.MakeTH1D(name, title);
+
+  }  // end 'MakeHistogram(string&, string&)'
+
+
+
+  // static methods =========================================================
+
+  // --------------------------------------------------------------------------
+  //! Check if a constituent belongs to the selected charge subset
+  // --------------------------------------------------------------------------
+  bool Types::EECEngine::IsInSubset(const Const::Subset sub, const int type, const int pid) {
+
+    // flow constituents can't be classified
+    if (sub == Const::Subset::All)   return true;
+    if (type == Const::Object::Flow)  return false;
+
+    // determine charge from object type
+    bool isCharged = false;
+    switch (type) {
+      case Const::Object::Track:
+        isCharged = true;
+        break;
+      case Const::Object::Particle:
+        isCharged = (Const::PidOntoCharge(pid) != 0.);
+        break;
+      default:
+        isCharged = false;
+        break;
+    }
+    return (sub == Const::Subset::Charged) ? isCharged : !isCharged;
+
+  }  // end 'IsInSubset(Const::Subset, int, int)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting binning and options
+  // --------------------------------------------------------------------------
+  Types::EECEngine::EECEngine(
+    const size_t bins,
+    const double rlMin,
+    const double rlMax,
+    const Const::EECWeight wgt,
+    const Const::Subset sub
+  ) {
+
+    // set log-spaced binning (checked by the axis)
+    hist = HistAccumulator(HistAxis(bins, rlMin, rlMax, true));
+
+    // set options
+    weight = wgt;
+    subset = sub;
+
+  }  // end ctor(size_t, double, double, Const::EECWeight, Const::Subset)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,156 @@
+/// ---------------------------------------------------------------------------
+/*! \file   EECEngine.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Pair loop to fill two-point energy-energy
+ *  correlators from jet constituents.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_EECENGINE_H
+#define SCORRELATORUTILITIES_EECENGINE_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+// root libraries
+#include <TH1D.h>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "Constants.h"
+#include "CstColumns.h"
+#include "HistAccumulator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Two-point energy-energy correlator engine
+    // ------------------------------------------------------------------------
+    /*! Accumulates sum_{i<j} w_i w_j / w_jet^2 vs.
+     *  R_L = sqrt(dEta^2 + dPhi^2) in log-spaced bins,
+     *  where w is the energy or pt of a constituent
+     *  (see Const::EECWeight). Only distinct pairs
+     *  are summed (no i = j self-terms, no j < i
+     *  double counting); ENCEngine sums distinct
+     *  N-tuples in the same way. Selected constituents
+     *  are copied into contiguous arrays, and pairs
+     *  are visited block by block. Within a block,
+     *  R_L^2 and the weights of a row of pairs are
+     *  computed first, and the log is only taken
+     *  when they're binned into a HistAccumulator.
+     *  FillReference() does the same with a plain
+     *  double loop for validation.
+     *
+     *  Tracks are taken as charged, towers and
+     *  clusters as neutral, and particles by their
+     *  PID. Flow constituents don't carry a charge
+     *  and are only kept for Const::Subset::All.
+     *
+     *  For threaded fills, give each thread its own
+     *  engine and Add() them in a fixed order once
+     *  the threads are done.
+     *
+     *  Pairs of a jet are fully correlated, so they
+     *  are summed per bin and each bin is filled
+     *  once per jet: errors are those of the
+     *  per-jet sums, and the histogram entries
+     *  count jets. With SetNReplicas(), bootstrap
+     *  replicas get the same per-jet sums with the
+     *  current event's weights (see
+     *  SetReplicaWeights()).
+     */
+    class EECEngine {
+
+      private:
+
+        // options
+        Const::EECWeight weight    = Const::EECWeight::Energy;
+        Const::Subset    subset    = Const::Subset::All;
+        size_t           blockSize = 64;
+
+        // accumulator (bin 0 is underflow, bin nBins + 1 overflow)
+        HistAccumulator hist;
+        uint64_t        nJets  = 0;
+        uint64_t        nPairs = 0;
+
+        // scratch arrays for selected constituents, pairs, per-jet bins, & replicas
+        vector<double> cstWgts;
+        vector<double> cstEtas;
+        vector<double> cstPhis;
+        vector<double> pairRL2;
+        vector<double> pairWgts;
+        vector<double> jetW;
+        vector<double> repWgts;
+
+        // private methods
+        void Select(const double wgt, const double eta, const double phi, const int type, const int pid);
+        void FillPairs(const double norm);
+        void AddJet();
+
+      public:
+
+        // getters
+        size_t                 GetNBins()     const {return hist.GetXAxis().GetNBins();}
+        size_t                 GetBlockSize() const {return blockSize;}
+        uint64_t               GetNJets()     const {return nJets;}
+        uint64_t               GetNPairs()    const {return nPairs;}
+        const vector<double>&  GetEdges()     const {return hist.GetXAxis().GetEdges();}
+        const vector<double>&  GetSumW()      const {return hist.GetSumW();}
+        const vector<double>&  GetSumW2()     const {return hist.GetSumW2();}
+        const HistAccumulator& GetHist()      const {return hist;}
+
+        // setters
+        void SetBlockSize(const size_t size) {blockSize = max(size, (size_t) 1);}
+
+        // public methods
+        void  Reset();
+        void  Add(const EECEngine& other);
+        void  SetNReplicas(const size_t replicas);
+        void  SetReplicaWeights(const vector<double>& wgts);
+        void  Fill(const JetInfo& jet, const vector<CstInfo>& csts, const double evtWeight = 1.);
+        void  Fill(const JetInfo& jet, const CstColumns& csts, const double evtWeight = 1.);
+        void  Fill(const JetInfo& jet, const CstColumns& csts, const size_t first, const size_t nCst, const double evtWeight = 1.);
+        void  FillReference(const JetInfo& jet, const vector<CstInfo>& csts, const double evtWeight = 1.);
+        TH1D* MakeHistogram(const string& name, const string& title = "") const;
+
+        // static methods
+        static bool IsInSubset(const Const::Subset sub, const int type, const int pid);
+
+        // default ctor/dtor
+        EECEngine()  {};
+        ~EECEngine() {};
+
+        // ctor accepting arguments
+        EECEngine(
+          const size_t bins,
+          const double rlMin,
+          const double rlMax,
+          const Const::EECWeight wgt = Const::EECWeight::Energy,
+          const Const::Subset sub = Const::Subset::All
+        );
+
+    };  // end EECEngine def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
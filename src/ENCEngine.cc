@@ -0,0 +1,451 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ENCEngine.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Kernels to fill projected N-point energy
+ *  correlators (E3C, E4C) from jet constituents.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_ENCENGINE_CC
+
+// class definition
+#include "ENCEngine.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // private methods ==========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a selected constituent into the scratch arrays
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Select(
+    const double wgt,
+    const double eta,
+    const double phi,
+    const int type,
+    const int pid
+  ) {
+
+    if (!EECEngine::IsInSubset(subset, type, pid)) return;
+
+    cstWgts.push_back(wgt);
+    cstEtas.push_back(eta);
+    cstPhis.push_back(phi);
+    return;
+
+  }  // end 'Select(double, double, double, int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Accumulate all distinct N-tuples of the selected constituents
+  // --------------------------------------------------------------------------
+  /*! A set {i, j, ...} is added when its longest
+   *  pair (i, j) is reached. At that point, the
+   *  other members are exactly the constituents
+   *  which are already neighbors of both i and j,
+   *  i.e. the AND of their neighbor bitsets. Ties
+   *  are fine: a set is still added only once,
+   *  when the last of its longest pairs is
+   *  reached.
+   */
+  void Types::ENCEngine::FillTuples(const double wgtJet, const double evtWeight) {
+
+    const size_t nCst   = cstWgts.size();
+    const size_t nWords = (nCst + 63) / 64;
+    const double norm   = evtWeight / pow(wgtJet, nPoints);
+    const HistAxis& axis   = hist.GetXAxis();
+    const size_t    nBins  = axis.GetNBins();
+    jetW.assign(nBins + 2, 0.);
+
+    // get sum over all distinct N-tuples, i.e. the
+    // elementary symmetric polynomial e_N of the weights
+    double sumTuples[5] = {1., 0., 0., 0., 0.};
+    for (const double wgt : cstWgts) {
+      for (size_t iPt = nPoints; iPt > 0; --iPt) {
+        sumTuples[iPt] += sumTuples[iPt - 1] * wgt;
+      }
+    }
+    double inHist = 0.;
+
+    // collect pairs below the upper edge & sort by distance
+    const double rl2Max = pow(10., 2. * axis.GetCoordMax());
+    pairs.clear();
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+      for (size_t jCst = iCst + 1; jCst < nCst; ++jCst) {
+        const double dEta = cstEtas[iCst] - cstEtas[jCst];
+        double       dPhi = cstPhis[iCst] - cstPhis[jCst];
+        dPhi = (dPhi > M_PI)  ? dPhi - (2. * M_PI) : dPhi;
+        dPhi = (dPhi < -M_PI) ? dPhi + (2. * M_PI) : dPhi;
+
+        const double rl2 = (dEta * dEta) + (dPhi * dPhi);
+        if (rl2 < rl2Max) pairs.emplace_back(rl2, iCst, jCst);
+      }
+    }
+    sort(pairs.begin(), pairs.end());
+
+    // now add sets in order of their longest pair
+    neighbors.assign(nCst * nWords, 0);
+    for (const auto& [rl2, iCst, jCst] : pairs) {
+
+      const double a    = cstWgts[iCst];
+      const double b    = cstWgts[jCst];
+      uint64_t*    nbrI = neighbors.data() + (iCst * nWords);
+      uint64_t*    nbrJ = neighbors.data() + (jCst * nWords);
+
+      // sum over common neighbors (& linked pairs of them)
+      double sum1  = 0.;
+      double sum11 = 0.;
+      for (size_t iWord = 0; iWord < nWords; ++iWord) {
+        uint64_t common = nbrI[iWord] & nbrJ[iWord];
+        while (common) {
+          const size_t kCst = (iWord * 64) + __builtin_ctzll(common);
+          const double c    = cstWgts[kCst];
+          common &= common - 1;
+
+          sum1 += c;
+          if (nPoints < 4) continue;
+
+          // for E4C, also pick up l > k linked to i, j, & k
+          const uint64_t* nbrK = neighbors.data() + (kCst * nWords);
+          for (size_t lWord = kCst / 64; lWord < nWords; ++lWord) {
+            uint64_t linked = nbrI[lWord] & nbrJ[lWord] & nbrK[lWord];
+            if (lWord == kCst / 64) {
+              linked &= ~((uint64_t(2) << (kCst % 64)) - 1);
+            }
+            while (linked) {
+              sum11 += c * cstWgts[(lWord * 64) + __builtin_ctzll(linked)];
+              linked &= linked - 1;
+            }
+          }
+        }
+      }  // end word loop
+
+      // add up the sets with (i, j) as longest pair
+      const double contrib = a * b * ((nPoints == 3) ? sum1 : sum11) * norm;
+      jetW[axis.GetBinFromCoordinate(0.5 * log10(rl2))] += contrib;
+      inHist += contrib;
+
+      // and link i & j
+      nbrI[jCst / 64] |= uint64_t(1) << (jCst % 64);
+      nbrJ[iCst / 64] |= uint64_t(1) << (iCst % 64);
+    }  // end pair loop
+
+    // everything else is overflow, up to rounding of the two sums
+    const double total    = sumTuples[nPoints] * norm;
+    const double residual = total - inHist;
+    if (abs(residual) > (1e-10 * abs(total))) {
+      jetW[nBins + 1] += residual;
+    }
+
+    AddJet();
+    return;
+
+  }  // end 'FillTuples(double, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add the current jet's bins to the accumulator
+  // --------------------------------------------------------------------------
+  /*! Each bin is filled once per jet, so the
+   *  errors are those of the per-jet sums, and
+   *  the jet counts as one entry.
+   */
+  void Types::ENCEngine::AddJet() {
+
+    hist.FillContents(jetW.data());
+    if (hist.GetNReplicas() > 0) {
+      hist.FillReplicas(jetW.data(), repWgts.data());
+    }
+    ++nJets;
+    return;
+
+  }  // end 'AddJet()'
+
+
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear accumulated jets
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Reset() {
+
+    hist.Reset();
+    nJets = 0;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add jets accumulated by another engine (e.g. on another thread)
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Add(const ENCEngine& other) {
+
+    if (nPoints != other.nPoints) {
+      cerr << PHWHERE << "PANIC: trying to add E" << other.nPoints << "C to E" << nPoints << "C!" << endl;
+      assert(nPoints == other.nPoints);
+    }
+
+    hist.Add(other.hist);
+    nJets += other.nJets;
+    return;
+
+  }  // end 'Add(ENCEngine&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Turn on (or off, for 0) bootstrap replicas
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::SetNReplicas(const size_t replicas) {
+
+    hist.SetNReplicas(replicas);
+    repWgts.assign(replicas, 1.);
+    return;
+
+  }  // end 'SetNReplicas(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set replica weights for the current event
+  // --------------------------------------------------------------------------
+  /*! E.g. from BootstrapWeights::GetWeights().
+   *  These are applied to every jet filled
+   *  until they're set again.
+   */
+  void Types::ENCEngine::SetReplicaWeights(const vector<double>& wgts) {
+
+    if (wgts.size() != repWgts.size()) {
+      cerr << PHWHERE << "PANIC: got " << wgts.size() << " replica weights for " << repWgts.size() << " replicas!" << endl;
+      assert(wgts.size() == repWgts.size());
+    }
+
+    repWgts = wgts;
+    return;
+
+  }  // end 'SetReplicaWeights(vector<double>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add N-tuples from a jet's constituents
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Fill(
+    const JetInfo& jet,
+    const vector<CstInfo>& csts,
+    const double evtWeight
+  ) {
+
+    // gather selected constituents
+    cstWgts.clear();
+    cstEtas.clear();
+    cstPhis.clear();
+    for (const CstInfo& cst : csts) {
+      Select(
+        (weight == Const::EECWeight::Pt) ? cst.GetPT() : cst.GetEne(),
+        cst.GetEta(),
+        cst.GetPhi(),
+        cst.GetType(),
+        cst.GetPID()
+      );
+    }
+
+    // normalize by jet energy (or pt)
+    FillTuples(
+      (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne(),
+      evtWeight
+    );
+    return;
+
+  }  // end 'Fill(JetInfo&, vector<CstInfo>&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add N-tuples from a jet's constituents stored column-wise
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Fill(
+    const JetInfo& jet,
+    const CstColumns& csts,
+    const double evtWeight
+  ) {
+
+    Fill(jet, csts, 0, csts.GetSize(), evtWeight);
+    return;
+
+  }  // end 'Fill(JetInfo&, CstColumns&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add N-tuples from a contiguous range of constituents stored column-wise
+  // --------------------------------------------------------------------------
+  void Types::ENCEngine::Fill(
+    const JetInfo& jet,
+    const CstColumns& csts,
+    const size_t first,
+    const size_t nCst,
+    const double evtWeight
+  ) {
+
+    // grab relevant columns
+    const vector<double>& wgts  = (weight == Const::EECWeight::Pt) ? csts.GetPT() : csts.GetEne();
+    const vector<double>& etas  = csts.GetEta();
+    const vector<double>& phis  = csts.GetPhi();
+    const vector<int>&    types = csts.GetType();
+    const vector<int>&    pids  = csts.GetPID();
+
+    // gather selected constituents
+    cstWgts.clear();
+    cstEtas.clear();
+    cstPhis.clear();
+    for (size_t iCst = first; iCst < first + nCst; ++iCst) {
+      Select(wgts[iCst], etas[iCst], phis[iCst], types[iCst], pids[iCst]);
+    }
+
+    // normalize by jet energy (or pt)
+    FillTuples(
+      (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne(),
+      evtWeight
+    );
+    return;
+
+  }  // end 'Fill(JetInfo&, CstColumns&, size_t, size_t, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add N-tuples from a jet's constituents with a naive loop over tuples
+  // --------------------------------------------------------------------------
+  /*! Reference implementation, O(M^N): loops
+   *  over every distinct N-tuple i1 < ... < iN.
+   *  Only meant for validation on small jets.
+   */
+  void Types::ENCEngine::FillReference(
+    const JetInfo& jet,
+    const vector<CstInfo>& csts,
+    const double evtWeight
+  ) {
+
+    // gather selected constituents
+    vector<const CstInfo*> selected;
+    for (const CstInfo& cst : csts) {
+      if (EECEngine::IsInSubset(subset, cst.GetType(), cst.GetPID())) {
+        selected.push_back(&cst);
+      }
+    }
+    const size_t nCst = selected.size();
+
+    // get all weights & distances
+    vector<double>         wgts(nCst);
+    vector<vector<double>> dists(nCst, vector<double>(nCst, 0.));
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+      wgts[iCst] = (weight == Const::EECWeight::Pt) ? selected[iCst] -> GetPT() : selected[iCst] -> GetEne();
+      for (size_t jCst = 0; jCst < nCst; ++jCst) {
+        const double dEta = selected[iCst] -> GetEta() - selected[jCst] -> GetEta();
+        const double dPhi = remainder(selected[iCst] -> GetPhi() - selected[jCst] -> GetPhi(), 2. * M_PI);
+        dists[iCst][jCst] = sqrt((dEta * dEta) + (dPhi * dPhi));
+      }
+    }
+
+    // loop over all distinct tuples, starting from (0, 1, ...)
+    const double wgtJet = (weight == Const::EECWeight::Pt) ? jet.GetPT() : jet.GetEne();
+    const double norm   = evtWeight / pow(wgtJet, nPoints);
+    jetW.assign(hist.GetXAxis().GetNBins() + 2, 0.);
+    vector<size_t> tuple(nPoints, 0);
+    for (size_t iPt = 0; iPt < nPoints; ++iPt) {
+      tuple[iPt] = iPt;
+    }
+    while (nCst >= nPoints) {
+
+      // get weight & largest distance
+      double wgt = norm;
+      double rl  = 0.;
+      for (size_t iPt = 0; iPt < nPoints; ++iPt) {
+        wgt *= wgts[tuple[iPt]];
+        for (size_t jPt = iPt + 1; jPt < nPoints; ++jPt) {
+          rl = max(rl, dists[tuple[iPt]][tuple[jPt]]);
+        }
+      }
+      jetW[hist.GetXAxis().GetBin(rl)] += wgt;
+
+      // advance to next tuple: bump the last index
+      // which can still move & reset the ones after it
+      size_t iPt = nPoints;
+      while ((iPt > 0) && (tuple[iPt - 1] == (nCst - nPoints + iPt - 1))) {
+        --iPt;
+      }
+      if (iPt == 0) break;
+
+      ++tuple[iPt - 1];
+      for (size_t jPt = iPt; jPt < nPoints; ++jPt) {
+        tuple[jPt] = tuple[jPt - 1] + 1;
+      }
+    }
+
+    AddJet();
+    return;
+
+  }  // end 'FillReference(JetInfo&, vector<CstInfo>&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Create a histogram of the accumulated correlator
+  // --------------------------------------------------------------------------
+  /*! The caller takes ownership of the
+   *  returned histogram.
+   */
+  TH1D* Types::ENCEngine::MakeHistogram(const string& name, const string& title) const {
+
+    return hist.MakeTH1D(name, title);
+
+  }  // end 'MakeHistogram(string&, string&)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting number of points, binning, and options
+  // --------------------------------------------------------------------------
+  Types::ENCEngine::ENCEngine(
+    const size_t points,
+    const size_t bins,
+    const double rlMin,
+    const double rlMax,
+    const Const::EECWeight wgt,
+    const Const::Subset sub
+  ) {
+
+    // check number of points
+    if ((points < 3) || (points > 4)) {
+      cerr << PHWHERE << "PANIC: projected ENC only implemented for N = 3, 4 (N = " << points << ")!" << endl;
+      assert((points >= 3) && (points <= 4));
+    }
+
+    // set log-spaced binning (checked by the axis)
+    nPoints = points;
+    hist    = HistAccumulator(HistAxis(bins, rlMin, rlMax, true));
+
+    // set options
+    weight = wgt;
+    subset = sub;
+
+  }  // end ctor(size_t, size_t, double, double, Const::EECWeight, Const::Subset)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
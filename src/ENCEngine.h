@@ -0,0 +1,153 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ENCEngine.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Kernels to fill projected N-point energy
+ *  correlators (E3C, E4C) from jet constituents.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_ENCENGINE_H
+#define SCORRELATORUTILITIES_ENCENGINE_H
+
+// c++ utilities
+#include <cmath>
+#include <tuple>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+// root libraries
+#include <TH1D.h>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "Constants.h"
+#include "EECEngine.h"
+#include "CstColumns.h"
+#include "HistAccumulator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Projected N-point energy correlator engine
+    // ------------------------------------------------------------------------
+    /*! Accumulates the projected ENC for N = 3 or 4,
+     *  i.e. the sum over distinct N-tuples of
+     *  constituents i1 < ... < iN of
+     *  w_i1...w_iN / w_jet^N vs. the largest pair
+     *  distance R_L of the tuple. This is the same
+     *  convention as EECEngine (distinct pairs
+     *  i < j), so there are no self-terms and
+     *  ENC/EEC ratios need no extra factors.
+     *  Weights and charge subsets follow EECEngine.
+     *
+     *  Rather than looping over N-tuples, each set
+     *  of distinct constituents is visited once:
+     *   - pairs are sorted by distance, and a set
+     *     is visited when its longest pair is
+     *     reached, via bitsets of each constituent's
+     *     shorter-distance neighbors; only true
+     *     candidates are ever looked at;
+     *   - sets whose longest pair is beyond the
+     *     binned range aren't visited at all, as
+     *     the overflow follows from the total,
+     *     e_N(w) / w_jet^N, with e_N the elementary
+     *     symmetric polynomial of the weights.
+     *  Cost is O(M^2 log M) for sorting plus one
+     *  step per set with all pairs in range.
+     *
+     *  Errors are accumulated per jet (sum of the
+     *  squared per-jet bin contents), and each jet
+     *  is one histogram entry. As for the
+     *  EECEngine, threads should each fill their
+     *  own engine, to be Add()-ed afterwards.
+     *  Bootstrap replicas are filled per jet too,
+     *  after SetNReplicas().
+     */
+    class ENCEngine {
+
+      private:
+
+        // number of points
+        size_t nPoints = 3;
+
+        // options
+        Const::EECWeight weight = Const::EECWeight::Energy;
+        Const::Subset    subset = Const::Subset::All;
+
+        // accumulator (bin 0 is underflow, bin nBins + 1 overflow)
+        HistAccumulator hist;
+        uint64_t        nJets = 0;
+
+        // scratch arrays for selected constituents, pairs, per-jet bins, & replicas
+        vector<double>                            cstWgts;
+        vector<double>                            cstEtas;
+        vector<double>                            cstPhis;
+        vector<tuple<double, uint32_t, uint32_t>> pairs;
+        vector<uint64_t>                          neighbors;
+        vector<double>                            jetW;
+        vector<double>                            repWgts;
+
+        // private methods
+        void Select(const double wgt, const double eta, const double phi, const int type, const int pid);
+        void FillTuples(const double wgtJet, const double evtWeight);
+        void AddJet();
+
+      public:
+
+        // getters
+        size_t                 GetNPoints() const {return nPoints;}
+        size_t                 GetNBins()   const {return hist.GetXAxis().GetNBins();}
+        uint64_t               GetNJets()   const {return nJets;}
+        const vector<double>&  GetEdges()   const {return hist.GetXAxis().GetEdges();}
+        const vector<double>&  GetSumW()    const {return hist.GetSumW();}
+        const vector<double>&  GetSumW2()   const {return hist.GetSumW2();}
+        const HistAccumulator& GetHist()    const {return hist;}
+
+        // public methods
+        void  Reset();
+        void  Add(const ENCEngine& other);
+        void  SetNReplicas(const size_t replicas);
+        void  SetReplicaWeights(const vector<double>& wgts);
+        void  Fill(const JetInfo& jet, const vector<CstInfo>& csts, const double evtWeight = 1.);
+        void  Fill(const JetInfo& jet, const CstColumns& csts, const double evtWeight = 1.);
+        void  Fill(const JetInfo& jet, const CstColumns& csts, const size_t first, const size_t nCst, const double evtWeight = 1.);
+        void  FillReference(const JetInfo& jet, const vector<CstInfo>& csts, const double evtWeight = 1.);
+        TH1D* MakeHistogram(const string& name, const string& title = "") const;
+
+        // default ctor/dtor
+        ENCEngine()  {};
+        ~ENCEngine() {};
+
+        // ctor accepting arguments
+        ENCEngine(
+          const size_t points,
+          const size_t bins,
+          const double rlMin,
+          const double rlMax,
+          const Const::EECWeight wgt = Const::EECWeight::Energy,
+          const Const::Subset sub = Const::Subset::All
+        );
+
+    };  // end ENCEngine def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,341 @@
+/// ---------------------------------------------------------------------------
+/*! \file   EventContext.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event cache of F4A node pointers.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_EVENTCONTEXT_CC
+
+// class definition
+#include "EventContext.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Get sequence number of current event
+  // --------------------------------------------------------------------------
+  optional<int> Interfaces::EventContext::GetEventSequence() {
+
+    if (!isSequenceSet) {
+      sequence      = Interfaces::GetEventSequence(topNode);
+      isSequenceSet = true;
+    }
+    return sequence;
+
+  }  // end 'GetEventSequence()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) track map
+  // --------------------------------------------------------------------------
+  SvtxTrackMap* Interfaces::EventContext::GetTrackMap() {
+
+    if (!trackMap) {
+      trackMap = Interfaces::GetTrackMap(topNode);
+    }
+    return trackMap;
+
+  }  // end 'GetTrackMap()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) vertex map
+  // --------------------------------------------------------------------------
+  GlobalVertexMap* Interfaces::EventContext::GetVertexMap() {
+
+    if (!vertexMap) {
+      vertexMap = Interfaces::GetVertexMap(topNode);
+    }
+    return vertexMap;
+
+  }  // end 'GetVertexMap()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) G4 truth info container
+  // --------------------------------------------------------------------------
+  PHG4TruthInfoContainer* Interfaces::EventContext::GetTruthContainer() {
+
+    if (!truthInfo) {
+      truthInfo = Interfaces::GetTruthContainer(topNode);
+    }
+    return truthInfo;
+
+  }  // end 'GetTruthContainer()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) HepMC event map
+  // --------------------------------------------------------------------------
+  PHHepMCGenEventMap* Interfaces::EventContext::GetMcEventMap() {
+
+    if (!mcEvtMap) {
+      mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    }
+    return mcEvtMap;
+
+  }  // end 'GetMcEventMap()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) particle flow container
+  // --------------------------------------------------------------------------
+  ParticleFlowElementContainer* Interfaces::EventContext::GetFlowStore() {
+
+    if (!flowStore) {
+      flowStore = Interfaces::GetFlowStore(topNode);
+    }
+    return flowStore;
+
+  }  // end 'GetFlowStore()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) raw tower container from a specified node
+  // --------------------------------------------------------------------------
+  RawTowerContainer* Interfaces::EventContext::GetRawTowerStore(const string_view node) {
+
+    auto itNode = rawTowerStores.find(node);
+    if (itNode == rawTowerStores.end()) {
+      itNode = rawTowerStores.emplace(node, Interfaces::GetRawTowerStore(topNode, string(node))).first;
+    }
+    return itNode -> second;
+
+  }  // end 'GetRawTowerStore(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) tower info container from a specified node
+  // --------------------------------------------------------------------------
+  TowerInfoContainer* Interfaces::EventContext::GetTowerInfoStore(const string_view node) {
+
+    auto itNode = towerInfoStores.find(node);
+    if (itNode == towerInfoStores.end()) {
+      itNode = towerInfoStores.emplace(node, Interfaces::GetTowerInfoStore(topNode, string(node))).first;
+    }
+    return itNode -> second;
+
+  }  // end 'GetTowerInfoStore(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) cluster container from a specified node
+  // --------------------------------------------------------------------------
+  RawClusterContainer* Interfaces::EventContext::GetClusterStore(const string_view node) {
+
+    auto itNode = clusterStores.find(node);
+    if (itNode == clusterStores.end()) {
+      itNode = clusterStores.emplace(node, Interfaces::GetClusterStore(topNode, string(node))).first;
+    }
+    return itNode -> second;
+
+  }  // end 'GetClusterStore(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (cached) tower geometry container from a specified node
+  // --------------------------------------------------------------------------
+  RawTowerGeomContainer* Interfaces::EventContext::GetTowerGeometries(const string_view node) {
+
+    auto itNode = geometries.find(node);
+    if (itNode == geometries.end()) {
+      itNode = geometries.emplace(node, Interfaces::GetTowerGeometries(topNode, string(node))).first;
+    }
+    return itNode -> second;
+
+  }  // end 'GetTowerGeometries(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific vertex from the cached vertex map
+  // --------------------------------------------------------------------------
+  GlobalVertex* Interfaces::EventContext::GetGlobalVertex(optional<int> iVtxToGrab) {
+
+    return Interfaces::GetGlobalVertex(GetVertexMap(), iVtxToGrab);
+
+  }  // end 'GetGlobalVertex(optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get primary vertex as a ROOT XYZVector
+  // --------------------------------------------------------------------------
+  ROOT::Math::XYZVector Interfaces::EventContext::GetRecoVtx() {
+
+    const GlobalVertex* vtx = GetGlobalVertex();
+    return ROOT::Math::XYZVector(vtx -> get_x(), vtx -> get_y(), vtx -> get_z());
+
+  }  // end 'GetRecoVtx()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get primary particles from the cached truth container
+  // --------------------------------------------------------------------------
+  PHG4TruthInfoContainer::ConstRange Interfaces::EventContext::GetPrimaries() {
+
+    return GetTruthContainer() -> GetPrimaryParticleRange();
+
+  }  // end 'GetPrimaries()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific HepMC event from the cached event map
+  // --------------------------------------------------------------------------
+  PHHepMCGenEvent* Interfaces::EventContext::GetMcEvent(const int iEvtToGrab) {
+
+    return Interfaces::GetMcEvent(GetMcEventMap(), iEvtToGrab);
+
+  }  // end 'GetMcEvent(int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get the GenEvt object from a specific HepMC event
+  // --------------------------------------------------------------------------
+  HepMC::GenEvent* Interfaces::EventContext::GetGenEvent(const int iEvtToGrab) {
+
+    return Interfaces::GetGenEvent(GetMcEventMap(), iEvtToGrab);
+
+  }  // end 'GetGenEvent(int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get particle flow objects from the cached container
+  // --------------------------------------------------------------------------
+  ParticleFlowElementContainer::ConstRange Interfaces::EventContext::GetParticleFlowObjects() {
+
+    return GetFlowStore() -> getParticleFlowElements();
+
+  }  // end 'GetParticleFlowObjects()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get raw towers from a cached container
+  // --------------------------------------------------------------------------
+  RawTowerContainer::ConstRange Interfaces::EventContext::GetRawTowers(const string_view store) {
+
+    return GetRawTowerStore(store) -> getTowers();
+
+  }  // end 'GetRawTowers(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get clusters from a cached container
+  // --------------------------------------------------------------------------
+  RawClusterContainer::ConstRange Interfaces::EventContext::GetClusters(const string_view store) {
+
+    return GetClusterStore(store) -> getClusters();
+
+  }  // end 'GetClusters(string_view)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific tower geometry
+  // --------------------------------------------------------------------------
+  RawTowerGeom* Interfaces::EventContext::GetTowerGeometry(const int subsys, const int rawKey) {
+
+    // resolve geometry container for subsystem once
+    auto itGeom = geometriesBySys.find(subsys);
+    if (itGeom == geometriesBySys.end()) {
+      itGeom = geometriesBySys.emplace(
+        subsys,
+        GetTowerGeometries( Const::IndexOntoTowerGeom(subsys) )
+      ).first;
+    }
+    return Interfaces::GetTowerGeometry(itGeom -> second, subsys, rawKey);
+
+  }  // end 'GetTowerGeometry(int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Point context at a new event and clear cached nodes & tables
+  // --------------------------------------------------------------------------
+  void Interfaces::EventContext::Reset(PHCompositeNode* node) {
+
+    topNode       = node;
+    generation    = NextEventGeneration();
+    isSequenceSet = false;
+    sequence      = nullopt;
+    trackMap      = NULL;
+    vertexMap     = NULL;
+    truthInfo     = NULL;
+    mcEvtMap      = NULL;
+    flowStore     = NULL;
+    rawTowerStores.clear();
+    towerInfoStores.clear();
+    clusterStores.clear();
+    geometries.clear();
+    geometriesBySys.clear();
+    trackLookup.Clear();
+    flowLookup.Clear();
+    rawTowerLookups.clear();
+    clusterLookups.clear();
+    return;
+
+  }  // end 'Reset(PHCompositeNode*)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Interfaces::EventContext::EventContext() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Interfaces::EventContext::~EventContext() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a top node
+  // --------------------------------------------------------------------------
+  Interfaces::EventContext::EventContext(PHCompositeNode* node) {
+
+    Reset(node);
+
+  }  // end 'ctor(PHCompositeNode*)'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
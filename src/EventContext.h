@@ -0,0 +1,202 @@
+/// ---------------------------------------------------------------------------
+/*! \file   EventContext.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event cache of F4A node pointers.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_EVENTCONTEXT_H
+#define SCORRELATORUTILITIES_EVENTCONTEXT_H
+
+// c++ utilities
+#include <map>
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include <optional>
+#include <unordered_map>
+// root libraries
+#include <Math/Vector3D.h>
+// phool libraries
+#include <phool/PHCompositeNode.h>
+// jet libraries
+#include <jetbase/Jet.h>
+// analysis utilities
+#include "ClustInterfaces.h"
+#include "FlowInterfaces.h"
+#include "NodeInterfaces.h"
+#include "ParInterfaces.h"
+#include "TrkInterfaces.h"
+#include "TwrInterfaces.h"
+#include "VtxInterfaces.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Interfaces {
+
+    // ------------------------------------------------------------------------
+    //! Lookup of constituents by ID
+    // ------------------------------------------------------------------------
+    /*! Maps constituent IDs onto the corresponding
+     *  objects of a container. A table is refilled
+     *  whenever its container (or its size)
+     *  changes, or when it's pointed at a new
+     *  event generation (see GetEventGeneration()).
+     *  Pointer and size alone can't detect a
+     *  container refilled in place, so tables
+     *  should either be owned by something that is
+     *  reset every event (e.g. an EventContext) or
+     *  be keyed on the generation.
+     */
+    template <typename T> class CstLookup {
+
+      private:
+
+        // data members
+        uint64_t                   generation = 0;
+        size_t                     size       = 0;
+        const void*                store      = nullptr;
+        unordered_map<int64_t, T*> table;
+
+      public:
+
+        // public methods
+        void Add(const int64_t id, T* object) {table.emplace(id, object);}
+        bool IsCurrent(const void* str, const size_t nObj) const {
+          return ((str == store) && (nObj == size));
+        }
+        void SetGeneration(const uint64_t gen) {
+          if (gen != generation) {
+            generation = gen;
+            store      = nullptr;
+            size       = 0;
+          }
+        }
+        void Reset(const void* str, const size_t nObj) {
+          store = str;
+          size  = nObj;
+          table.clear();
+          table.reserve(nObj);
+        }
+        void Clear() {
+          generation = 0;
+          store      = nullptr;
+          size       = 0;
+          table.clear();
+        }
+        T* Find(const int64_t id) const {
+          auto itObj = table.find(id);
+          return (itObj != table.end()) ? itObj -> second : nullptr;
+        }
+
+    };  // end CstLookup def
+
+
+
+    // ------------------------------------------------------------------------
+    //! Event context
+    // ------------------------------------------------------------------------
+    /*! Wraps the top node of an event and resolves
+     *  each F4A node at most once, so that repeated
+     *  per-object lookups don't redo the (string-keyed,
+     *  recursive) node-tree search. The context
+     *  also owns the constituent lookup tables, so
+     *  they never outlive the event they were built
+     *  for. A context should be created, or reset,
+     *  once per event (and reset again if a
+     *  container is refilled within an event).
+     *  Each creation or reset starts a new event
+     *  generation, which invalidates the
+     *  per-thread tables used by finders that
+     *  aren't handed a context.
+     */
+    class EventContext {
+
+      private:
+
+        // top node & generation of current event
+        PHCompositeNode* topNode    = NULL;
+        uint64_t         generation = 0;
+
+        // event sequence (may legitimately be empty)
+        bool          isSequenceSet = false;
+        optional<int> sequence      = nullopt;
+
+        // cached nodes
+        SvtxTrackMap*                               trackMap  = NULL;
+        GlobalVertexMap*                            vertexMap = NULL;
+        PHG4TruthInfoContainer*                     truthInfo = NULL;
+        PHHepMCGenEventMap*                         mcEvtMap  = NULL;
+        ParticleFlowElementContainer*               flowStore = NULL;
+        map<string, RawTowerContainer*, less<>>     rawTowerStores;
+        map<string, TowerInfoContainer*, less<>>    towerInfoStores;
+        map<string, RawClusterContainer*, less<>>   clusterStores;
+        map<string, RawTowerGeomContainer*, less<>> geometries;
+        map<int, RawTowerGeomContainer*>            geometriesBySys;
+
+        // constituent lookup tables
+        CstLookup<SvtxTrack>                 trackLookup;
+        CstLookup<ParticleFlowElement>       flowLookup;
+        map<Jet::SRC, CstLookup<RawTower>>   rawTowerLookups;
+        map<Jet::SRC, CstLookup<RawCluster>> clusterLookups;
+
+      public:
+
+        // general getters
+        PHCompositeNode* GetTopNode()    const {return topNode;}
+        uint64_t         GetGeneration() const {return generation;}
+        optional<int>    GetEventSequence();
+
+        // node getters
+        SvtxTrackMap*                 GetTrackMap();
+        GlobalVertexMap*              GetVertexMap();
+        PHG4TruthInfoContainer*       GetTruthContainer();
+        PHHepMCGenEventMap*           GetMcEventMap();
+        ParticleFlowElementContainer* GetFlowStore();
+        RawTowerContainer*            GetRawTowerStore(const string_view node);
+        TowerInfoContainer*           GetTowerInfoStore(const string_view node);
+        RawClusterContainer*          GetClusterStore(const string_view node);
+        RawTowerGeomContainer*        GetTowerGeometries(const string_view node);
+
+        // derived getters
+        GlobalVertex*                            GetGlobalVertex(optional<int> iVtxToGrab = nullopt);
+        ROOT::Math::XYZVector                    GetRecoVtx();
+        PHG4TruthInfoContainer::ConstRange       GetPrimaries();
+        PHHepMCGenEvent*                         GetMcEvent(const int iEvtToGrab);
+        HepMC::GenEvent*                         GetGenEvent(const int iEvtToGrab);
+        ParticleFlowElementContainer::ConstRange GetParticleFlowObjects();
+        RawTowerContainer::ConstRange            GetRawTowers(const string_view store);
+        RawClusterContainer::ConstRange          GetClusters(const string_view store);
+        RawTowerGeom*                            GetTowerGeometry(const int subsys, const int rawKey);
+
+        // lookup getters
+        CstLookup<SvtxTrack>&           GetTrackLookup()                        {return trackLookup;}
+        CstLookup<ParticleFlowElement>& GetFlowLookup()                         {return flowLookup;}
+        CstLookup<RawTower>&            GetRawTowerLookup(const Jet::SRC source) {return rawTowerLookups[source];}
+        CstLookup<RawCluster>&          GetClusterLookup(const Jet::SRC source)  {return clusterLookups[source];}
+
+        // public methods
+        void Reset(PHCompositeNode* node);
+
+        // default ctor/dtor
+        EventContext();
+        ~EventContext();
+
+        // ctors accepting arguments
+        explicit EventContext(PHCompositeNode* node);
+
+    };  // end EventContext def
+
+  }  // end Interfaces namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
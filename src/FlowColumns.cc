@@ -0,0 +1,240 @@
+/// ---------------------------------------------------------------------------
+/*! \file   FlowColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for particle flow info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_FLOWCOLUMNS_CC
+
+// class definition
+#include "FlowColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a FlowInfo
+  // --------------------------------------------------------------------------
+  Types::FlowInfo Types::FlowColumns::GetInfo(const size_t row) const {
+
+    FlowInfo info;
+    info.SetID( id[row] );
+    info.SetType( type[row] );
+    info.SetMass( mass[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    info.SetEne( ene[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetPT( pt[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of FlowInfo
+  // --------------------------------------------------------------------------
+  vector<Types::FlowInfo> Types::FlowColumns::GetInfos() const {
+
+    vector<FlowInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a FlowInfo
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::SetRow(const size_t row, const FlowInfo& info) {
+
+    id  [row] = info.GetID();
+    type[row] = info.GetType();
+    mass[row] = info.GetMass();
+    eta [row] = info.GetEta();
+    phi [row] = info.GetPhi();
+    ene [row] = info.GetEne();
+    px  [row] = info.GetPX();
+    py  [row] = info.GetPY();
+    pz  [row] = info.GetPZ();
+    pt  [row] = info.GetPT();
+    return;
+
+  }  // end 'SetRow(size_t, FlowInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of FlowInfo
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::SetInfos(const vector<FlowInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const FlowInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<FlowInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a FlowInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::Append(const FlowInfo& info) {
+
+    id  .push_back( info.GetID() );
+    type.push_back( info.GetType() );
+    mass.push_back( info.GetMass() );
+    eta .push_back( info.GetEta() );
+    phi .push_back( info.GetPhi() );
+    ene .push_back( info.GetEne() );
+    px  .push_back( info.GetPX() );
+    py  .push_back( info.GetPY() );
+    pz  .push_back( info.GetPZ() );
+    pt  .push_back( info.GetPT() );
+    return;
+
+  }  // end 'Append(FlowInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::Reserve(const size_t size) {
+
+    id.reserve(size);
+    type.reserve(size);
+    mass.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed FlowInfo.
+   */
+  void Types::FlowColumns::Resize(const size_t size) {
+
+    id  .resize(size, numeric_limits<int>::max());
+    type.resize(size, numeric_limits<int>::max());
+    mass.resize(size, numeric_limits<double>::max());
+    eta .resize(size, numeric_limits<double>::max());
+    phi .resize(size, numeric_limits<double>::max());
+    ene .resize(size, numeric_limits<double>::max());
+    px  .resize(size, numeric_limits<double>::max());
+    py  .resize(size, numeric_limits<double>::max());
+    pz  .resize(size, numeric_limits<double>::max());
+    pt  .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::Reset() {
+
+    id.clear();
+    type.clear();
+    mass.clear();
+    eta.clear();
+    phi.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::FlowColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&mass, &eta, &phi, &ene, &px, &py, &pz, &pt}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::FlowColumns::FlowColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::FlowColumns::~FlowColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of FlowInfo
+  // --------------------------------------------------------------------------
+  Types::FlowColumns::FlowColumns(const vector<FlowInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<FlowInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,151 @@
+/// ---------------------------------------------------------------------------
+/*! \file   FlowColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for particle flow info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_FLOWCOLUMNS_H
+#define SCORRELATORUTILITIES_FLOWCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "FlowInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Particle flow info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to FlowInfo:
+     *  each member of FlowInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  particle flow elements only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  FlowInfo. As in FlowInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class FlowColumns {
+
+      private:
+
+        // data members
+        vector<int>        id;
+        vector<int>        type;
+        vector<Double32_t> mass;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> ene;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> pt;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as FlowInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const FlowColumns* columns = nullptr;  //!
+            size_t             index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t GetIndex() const {return index;}
+            int    GetID()    const {return columns -> id[index];}
+            int    GetType()  const {return columns -> type[index];}
+            double GetMass()  const {return columns -> mass[index];}
+            double GetEta()   const {return columns -> eta[index];}
+            double GetPhi()   const {return columns -> phi[index];}
+            double GetEne()   const {return columns -> ene[index];}
+            double GetPX()    const {return columns -> px[index];}
+            double GetPY()    const {return columns -> py[index];}
+            double GetPZ()    const {return columns -> pz[index];}
+            double GetPT()    const {return columns -> pt[index];}
+
+            // conversion to FlowInfo
+            FlowInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator FlowInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const FlowColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&    GetID()   const {return id;}
+        const vector<int>&    GetType() const {return type;}
+        const vector<double>& GetMass() const {return mass;}
+        const vector<double>& GetEta()  const {return eta;}
+        const vector<double>& GetPhi()  const {return phi;}
+        const vector<double>& GetEne()  const {return ene;}
+        const vector<double>& GetPX()   const {return px;}
+        const vector<double>& GetPY()   const {return py;}
+        const vector<double>& GetPZ()   const {return pz;}
+        const vector<double>& GetPT()   const {return pt;}
+
+        // public methods
+        size_t           GetSize() const {return id.size();}
+        bool             IsEmpty() const {return id.empty();}
+        Row              GetRow(const size_t row) const {return Row(this, row);}
+        FlowInfo         GetInfo(const size_t row) const;
+        vector<FlowInfo> GetInfos() const;
+        void             SetRow(const size_t row, const FlowInfo& info);
+        void             SetInfos(const vector<FlowInfo>& infos);
+        void             Append(const FlowInfo& info);
+        void             Reserve(const size_t size);
+        void             Resize(const size_t size);
+        void             Reset();
+        void             RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        FlowColumns();
+        ~FlowColumns();
+
+        // ctor accepting arguments
+        FlowColumns(const vector<FlowInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(FlowColumns, 2)
+
+    };  // end FlowColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
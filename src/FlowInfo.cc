@@ -121,6 +121,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::FlowInfo::RestoreLimits() {
+
+    for (double* member : {&mass, &eta, &phi, &ene, &px, &py, &pz, &pt}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #define SCORRELATORUTILITIES_FLOWINFO_H
 
 // c++ utilities
+#include <cmath>
 #include <limits>
 #include <vector>
 #include <string>
@@ -45,16 +46,16 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int    id   = numeric_limits<int>::max();
-        int    type = numeric_limits<int>::max();
-        double mass = numeric_limits<double>::max();
-        double eta  = numeric_limits<double>::max();
-        double phi  = numeric_limits<double>::max();
-        double ene  = numeric_limits<double>::max();
-        double px   = numeric_limits<double>::max();
-        double py   = numeric_limits<double>::max();
-        double pz   = numeric_limits<double>::max();
-        double pt   = numeric_limits<double>::max();
+        int        id   = numeric_limits<int>::max();
+        int        type = numeric_limits<int>::max();
+        Double32_t mass = numeric_limits<double>::max();
+        Double32_t eta  = numeric_limits<double>::max();
+        Double32_t phi  = numeric_limits<double>::max();
+        Double32_t ene  = numeric_limits<double>::max();
+        Double32_t px   = numeric_limits<double>::max();
+        Double32_t py   = numeric_limits<double>::max();
+        Double32_t pz   = numeric_limits<double>::max();
+        Double32_t pt   = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -91,6 +92,7 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(const ParticleFlowElement* flow);
         bool IsInAcceptance(const FlowInfo& minimum, const FlowInfo& maximum) const;
         bool IsInAcceptance(const pair<FlowInfo, FlowInfo>& range) const;
+        void RestoreLimits();
 
         // static methods
         static vector<string> GetListOfMembers();
@@ -110,7 +112,7 @@ namespace SColdQcdCorrelatorAnalysis {
         FlowInfo(const ParticleFlowElement* flow);
 
       // identify this class to ROOT
-      ClassDefNV(FlowInfo, 1);
+      ClassDefNV(FlowInfo, 2);
 
     };  // end FlowInfo definition
 
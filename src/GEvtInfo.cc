@@ -27,6 +27,9 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::GEvtInfo::Minimize() {
 
+    // nothing left to fetch
+    pending = 0;
+
     // minimize atomic members
     nChrgPar = -1 * numeric_limits<int>::max();
     nNeuPar  = -1 * numeric_limits<int>::max();
@@ -46,6 +49,9 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::GEvtInfo::Maximize() {
 
+    // nothing left to fetch
+    pending = 0;
+
     // maximize atomic members
     nChrgPar = numeric_limits<int>::max();
     nNeuPar  = numeric_limits<int>::max();
@@ -60,6 +66,42 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Compute any pending groups of members
+  // --------------------------------------------------------------------------
+  /*! If everything is pending, the fused event
+   *  summary is used. If only the partons are
+   *  needed, just the signal subevent is read.
+   */
+  void Types::GEvtInfo::Fetch(const uint8_t parts) const {
+
+    const uint8_t toFetch = pending & parts;
+    if (toFetch == 0) return;
+
+    Interfaces::EventContext context(lazyNode);
+    const int signal = isEmbed ? Const::SubEvt::EmbedSignal : Const::SubEvt::NotEmbedSignal;
+    if (toFetch & Lazy::Sums) {
+      const Tools::GEvtSummary summary = Tools::GetGEvtSummary(
+        context,
+        lazyEvts,
+        (toFetch & Lazy::Partons) ? optional<int>(signal) : nullopt
+      );
+      if (toFetch & Lazy::Partons) partons = summary.partons;
+      nChrgPar = summary.nChrgPar;
+      nNeuPar  = summary.nNeuPar;
+      eSumChrg = summary.eSumChrg;
+      eSumNeu  = summary.eSumNeu;
+    } else {
+      partons.first  = Tools::GetPartonInfo(context, signal, Const::HardScatterStatus::First);
+      partons.second = Tools::GetPartonInfo(context, signal, Const::HardScatterStatus::Second);
+    }
+    pending &= ~toFetch;
+    return;
+
+  }  // end 'Fetch(uint8_t)'
+
+
+
   // public methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -67,8 +109,11 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::GEvtInfo::Reset() {
 
-    // reset embed flag
-    isEmbed = false;
+    // reset embed flag & lazy state
+    isEmbed  = false;
+    lazyNode = nullptr;
+    pending  = 0;
+    lazyEvts.clear();
 
     // maximize everyting else
     Maximize();
@@ -87,28 +132,86 @@ namespace SColdQcdCorrelatorAnalysis {
     const vector<int> evtsToGrab
   ) {
 
-    // set embed flag
-    isEmbed = embed;
+    Interfaces::EventContext context(topNode);
+    SetInfo(context, embed, evtsToGrab);
+    return;
+
+  }  // end 'SetInfo(PHCompositeNode*, vector<int>)'
 
-    // set parton info
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A node and a list of subevents using an event context
+  // --------------------------------------------------------------------------
+  void Types::GEvtInfo::SetInfo(
+    Interfaces::EventContext& context,
+    const bool embed,
+    const vector<int> evtsToGrab
+  ) {
+
+    // set embed flag & clear lazy state
     isEmbed  = embed;
-    if (isEmbed) {
-      partons.first  = Tools::GetPartonInfo(topNode, Const::SubEvt::EmbedSignal, Const::HardScatterStatus::First);
-      partons.second = Tools::GetPartonInfo(topNode, Const::SubEvt::EmbedSignal, Const::HardScatterStatus::Second);
+    lazyNode = nullptr;
+    pending  = 0;
+    lazyEvts.clear();
+
+    // summarize event in one pass
+    const Tools::GEvtSummary summary = Tools::GetGEvtSummary(
+      context,
+      evtsToGrab,
+      isEmbed ? Const::SubEvt::EmbedSignal : Const::SubEvt::NotEmbedSignal
+    );
+
+    // set parton info & sums
+    partons  = summary.partons;
+    nChrgPar = summary.nChrgPar;
+    nNeuPar  = summary.nNeuPar;
+    eSumChrg = summary.eSumChrg;
+    eSumNeu  = summary.eSumNeu;
+    return;
+
+  }  // end 'SetInfo(EventContext&, vector<int>)'
+
 
-    } else {
-      partons.first  = Tools::GetPartonInfo(topNode, Const::SubEvt::NotEmbedSignal, Const::HardScatterStatus::First);
-      partons.second = Tools::GetPartonInfo(topNode, Const::SubEvt::NotEmbedSignal, Const::HardScatterStatus::Second);
-    }
 
-    // get sums
-    nChrgPar = Tools::GetNumFinalStatePars(topNode, evtsToGrab, Const::Subset::Charged);
-    nNeuPar  = Tools::GetNumFinalStatePars(topNode, evtsToGrab, Const::Subset::Neutral);
-    eSumChrg = Tools::GetSumFinalStateParEne(topNode, evtsToGrab, Const::Subset::Charged);
-    eSumNeu  = Tools::GetSumFinalStateParEne(topNode, evtsToGrab, Const::Subset::Neutral);
+  // --------------------------------------------------------------------------
+  //! Point object to a F4A node and a list of subevents without computing anything yet
+  // --------------------------------------------------------------------------
+  /*! Partons and sums are then computed the
+   *  first time one of their getters is
+   *  called. The node must stay valid until
+   *  then, i.e. within the current event.
+   */
+  void Types::GEvtInfo::SetInfoLazy(
+    PHCompositeNode* topNode,
+    const bool embed,
+    const vector<int> evtsToGrab
+  ) {
+
+    Reset();
+    isEmbed  = embed;
+    lazyNode = topNode;
+    lazyEvts = evtsToGrab;
+    pending  = Lazy::All;
     return;
 
-  }  // end 'SetInfo(PHCompositeNode*, vector<int>)'
+  }  // end 'SetInfoLazy(PHCompositeNode*, bool, vector<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Compute all pending members
+  // --------------------------------------------------------------------------
+  /*! Call before writing a lazily set object
+   *  out, since ROOT I/O reads the members
+   *  directly.
+   */
+  void Types::GEvtInfo::Materialize() {
+
+    Fetch(Lazy::All);
+    return;
+
+  }  // end 'Materialize()'
 
 
 
@@ -143,6 +246,38 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // overloaded operators =====================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy assignment
+  // --------------------------------------------------------------------------
+  /*! Pending members of the source are fetched
+   *  first, while its node is still valid, so
+   *  the copy never refers to that node.
+   */
+  Types::GEvtInfo& Types::GEvtInfo::operator =(const GEvtInfo& other) {
+
+    if (this == &other) return *this;
+    other.Fetch(Lazy::All);
+
+    // copy members
+    nChrgPar = other.nChrgPar;
+    nNeuPar  = other.nNeuPar;
+    isEmbed  = other.isEmbed;
+    eSumChrg = other.eSumChrg;
+    eSumNeu  = other.eSumNeu;
+    partons  = other.partons;
+
+    // and clear lazy state
+    lazyNode = nullptr;
+    pending  = 0;
+    lazyEvts.clear();
+    return *this;
+
+  }  // end 'operator =(GEvtInfo&)'
+
+
+
   // ctor/dtor ================================================================
 
   // --------------------------------------------------------------------------
@@ -167,6 +302,17 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Copy constructor
+  // --------------------------------------------------------------------------
+  Types::GEvtInfo::GEvtInfo(const GEvtInfo& other) {
+
+    *this = other;
+
+  }  // end ctor(GEvtInfo&)
+
+
+
   // --------------------------------------------------------------------------
   //! Constructor accepting initialization option (minimize or maximize)
   // --------------------------------------------------------------------------
@@ -201,6 +347,41 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(PHCompositeNode*, int, vector<int>)'
 
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting an event context and a list of subevents
+  // --------------------------------------------------------------------------
+  Types::GEvtInfo::GEvtInfo(
+    Interfaces::EventContext& context,
+    const bool embed,
+    vector<int> evtsToGrab
+  ) {
+
+    SetInfo(context, embed, evtsToGrab);
+
+  }  // end ctor(EventContext&, int, vector<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A node, a list of subevents, and a lazy evaluation flag
+  // --------------------------------------------------------------------------
+  Types::GEvtInfo::GEvtInfo(
+    PHCompositeNode* topNode,
+    const bool embed,
+    vector<int> evtsToGrab,
+    const bool lazy
+  ) {
+
+    if (lazy) {
+      SetInfoLazy(topNode, embed, evtsToGrab);
+    } else {
+      SetInfo(topNode, embed, evtsToGrab);
+    }
+
+  }  // end ctor(PHCompositeNode*, bool, vector<int>, bool)
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
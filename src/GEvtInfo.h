@@ -15,6 +15,7 @@
 #include <limits>
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <utility>
 #include <optional>
 // root libraries
@@ -41,58 +42,82 @@ namespace SColdQcdCorrelatorAnalysis {
      *  generator (truth) information. Can
      *  be built by pointing class to a
      *  F4A node and providing a list of
-     *  subevents to process.
+     *  subevents to process. Copies are
+     *  never lazy: anything pending is
+     *  fetched from the source first.
      */ 
     class GEvtInfo {
 
       private:
 
-        // data members
-        int                    nChrgPar = numeric_limits<int>::max();
-        int                    nNeuPar  = numeric_limits<int>::max();
-        bool                   isEmbed  = false;
-        double                 eSumChrg = numeric_limits<double>::max();
-        double                 eSumNeu  = numeric_limits<double>::max();
-        pair<ParInfo, ParInfo> partons;
+        // data members (mutable so lazy getters can fill them)
+        mutable int                    nChrgPar = numeric_limits<int>::max();
+        mutable int                    nNeuPar  = numeric_limits<int>::max();
+        bool                           isEmbed  = false;
+        mutable double                 eSumChrg = numeric_limits<double>::max();
+        mutable double                 eSumNeu  = numeric_limits<double>::max();
+        mutable pair<ParInfo, ParInfo> partons;
+
+        // lazy evaluation state (not persistified)
+        PHCompositeNode* lazyNode = nullptr;  //!
+        vector<int>      lazyEvts;            //!
+        mutable uint8_t  pending  = 0;        //!
+
+        //! Groups of members which can be computed lazily
+        enum Lazy : uint8_t {Partons = 1, Sums = 2, All = 3};
 
         // private methods
         void Minimize();
         void Maximize();
+        void Fetch(const uint8_t parts) const;
 
       public:
 
         // getters
-        int                    GetNChrgPar() const {return nChrgPar;}
-        int                    GetNNeuPar()  const {return nNeuPar;}
+        int                    GetNChrgPar() const {Fetch(Lazy::Sums);    return nChrgPar;}
+        int                    GetNNeuPar()  const {Fetch(Lazy::Sums);    return nNeuPar;}
         bool                   GetIsEmbed()  const {return isEmbed;}
-        double                 GetESumChrg() const {return eSumChrg;}
-        double                 GetESumNeu()  const {return eSumNeu;}
-        ParInfo                GetPartonA()  const {return partons.first;}
-        ParInfo                GetPartonB()  const {return partons.second;}
-        pair<ParInfo, ParInfo> GetPartons()  const {return partons;} 
-
-        // setters
-        void SetNChrgPar(const int arg_nChrgPar)                  {nChrgPar = arg_nChrgPar;}
-        void SetNNeuPar(const int arg_nNeuPar)                    {nNeuPar  = arg_nNeuPar;}
-        void SetIsEmbed(const bool arg_isEmbed)                   {isEmbed  = arg_isEmbed;}
-        void SetESumChrg(const double arg_eSumChrg)               {eSumChrg = arg_eSumChrg;}
-        void SetESumNeu(const double arg_eSumNeu)                 {eSumNeu  = arg_eSumNeu;}
-        void SetPartons(const pair<ParInfo, ParInfo> arg_partons) {partons  = arg_partons;} 
+        double                 GetESumChrg() const {Fetch(Lazy::Sums);    return eSumChrg;}
+        double                 GetESumNeu()  const {Fetch(Lazy::Sums);    return eSumNeu;}
+        ParInfo                GetPartonA()  const {Fetch(Lazy::Partons); return partons.first;}
+        ParInfo                GetPartonB()  const {Fetch(Lazy::Partons); return partons.second;}
+        pair<ParInfo, ParInfo> GetPartons()  const {Fetch(Lazy::Partons); return partons;} 
+        bool                   IsLazy()      const {return (pending != 0);}
+
+        // setters (resolve the member's group first, so a
+        // pending fetch can't overwrite the set value)
+        void SetNChrgPar(const int arg_nChrgPar)                  {Fetch(Lazy::Sums);          nChrgPar = arg_nChrgPar;}
+        void SetNNeuPar(const int arg_nNeuPar)                    {Fetch(Lazy::Sums);          nNeuPar  = arg_nNeuPar;}
+        void SetIsEmbed(const bool arg_isEmbed)                   {Fetch(Lazy::Partons);       isEmbed  = arg_isEmbed;}
+        void SetESumChrg(const double arg_eSumChrg)               {Fetch(Lazy::Sums);          eSumChrg = arg_eSumChrg;}
+        void SetESumNeu(const double arg_eSumNeu)                 {Fetch(Lazy::Sums);          eSumNeu  = arg_eSumNeu;}
+        void SetPartons(const pair<ParInfo, ParInfo> arg_partons) {pending &= ~Lazy::Partons; partons  = arg_partons;} 
 
         // public methods
         void Reset();
         void SetInfo(PHCompositeNode* topNode, const bool embed, const vector<int> evtsToGrab);
+        void SetInfo(Interfaces::EventContext& context, const bool embed, const vector<int> evtsToGrab);
+        void SetInfoLazy(PHCompositeNode* topNode, const bool embed, const vector<int> evtsToGrab);
+        void Materialize();
 
         // static methods
         static vector<string> GetListOfMembers();
 
+        // overloaded operators
+        GEvtInfo& operator =(const GEvtInfo& other);
+
         // default ctor/dtor
         GEvtInfo();
         ~GEvtInfo();
 
+        // copy ctor
+        GEvtInfo(const GEvtInfo& other);
+
         // ctors accepting arguments
         GEvtInfo(const Const::Init init);
         GEvtInfo(PHCompositeNode* topNode, const bool embed, vector<int> evtsToGrab);
+        GEvtInfo(Interfaces::EventContext& context, const bool embed, vector<int> evtsToGrab);
+        GEvtInfo(PHCompositeNode* topNode, const bool embed, vector<int> evtsToGrab, const bool lazy);
 
       // identify this class to ROOT
       ClassDefNV(GEvtInfo, 1);
@@ -38,12 +38,29 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<float> chargeToGrab
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GetNumFinalStatePars(context, evtsToGrab, subset, chargeToGrab);
+
+  }  // end 'GetNumFinalStatePars(PHCompositeNode*, vector<int>, optional<float>, optional<float> bool)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get total number of final state particles using an event context
+  // --------------------------------------------------------------------------
+  int64_t Tools::GetNumFinalStatePars(
+    Interfaces::EventContext& context,
+    const vector<int> evtsToGrab,
+    const Const::Subset subset,
+    optional<float> chargeToGrab
+  ) {
+
     // loop over subevents
     int64_t nPar = 0;
     for (const int evtToGrab : evtsToGrab) {
 
       // loop over particles
-      HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, evtToGrab);
+      HepMC::GenEvent* genEvt = context.GetGenEvent(evtToGrab);
       for (
         HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
         particle != genEvt -> particles_end();
@@ -91,7 +108,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end subevent loop
     return nPar;
 
-  }  // end 'GetNumFinalStatePars(PHCompositeNode*, vector<int>, optional<float>, optional<float> bool)'
+  }  // end 'GetNumFinalStatePars(EventContext&, vector<int>, optional<float>, optional<float> bool)'
 
 
 
@@ -111,11 +128,28 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<float> chargeToGrab
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GetSumFinalStateParEne(context, evtsToGrab, subset, chargeToGrab);
+
+  }  // end 'GetSumFinalStateParEne(PHCompositeNode*, vector<int>, int, optional<float>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get total number of final state particles using an event context
+  // --------------------------------------------------------------------------
+  double Tools::GetSumFinalStateParEne(
+    Interfaces::EventContext& context,
+    const vector<int> evtsToGrab,
+    const Const::Subset subset,
+    optional<float> chargeToGrab
+  ) {
+
     // loop over subevents
     double eSum = 0.;
     for (const int evtToGrab : evtsToGrab) {
 
-      HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, evtToGrab);
+      HepMC::GenEvent* genEvt = context.GetGenEvent(evtToGrab);
       for (
         HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
         particle != genEvt -> particles_end();
@@ -164,7 +198,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end subevent loop
     return eSum;
 
-  }  // end 'GetSumFinalStateParEne(PHCompositeNode*, vector<int>, int, optional<float>)'
+  }  // end 'GetSumFinalStateParEne(EventContext&, vector<int>, int, optional<float>)'
 
 
 
@@ -177,8 +211,24 @@ namespace SColdQcdCorrelatorAnalysis {
     const int status
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GetPartonInfo(context, event, status);
+
+  }  // end 'GetPartonInfo(PHCompositeNode*, int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull information of a parton with a specified status from a subevent using an event context
+  // --------------------------------------------------------------------------
+  Types::ParInfo Tools::GetPartonInfo(
+    Interfaces::EventContext& context,
+    const int event,
+    const int status
+  ) {
+
     // pick out relevant sub-sevent to grab
-    HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, event);
+    HepMC::GenEvent* genEvt = context.GetGenEvent(event);
 
     // loop over particles
     Types::ParInfo parton;
@@ -188,21 +238,160 @@ namespace SColdQcdCorrelatorAnalysis {
       ++particle
     ) {
 
+      // ignore particles without desired status
+      if ((*particle) -> status() != status) continue;
+
       // grab particle info
       parton.Reset();
       parton.SetInfo(*particle, event);
 
-      // ignore all non-partons
-      if (parton.IsParton()) continue;
-
-      // exit loop with info if parton is desired status
-      if (parton.IsHardScatterProduct()) {
-        break;
-      } 
+      // exit loop with info if a parton
+      if (parton.IsParton()) {
+        return parton;
+      }
     }  // end particle loop
+
+    // if no parton found, return default info
+    parton.Reset();
     return parton;
 
-  }  // end 'GetPartonInfo(PHCompositeNode*, int, int)'
+  }  // end 'GetPartonInfo(EventContext&, int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Summarize final state particles & partons of an event
+  // --------------------------------------------------------------------------
+  Tools::GEvtSummary Tools::GetGEvtSummary(
+    PHCompositeNode* topNode,
+    const vector<int> evtsToGrab,
+    optional<int> partonEvt,
+    const vector<pair<float, float>> etaWindows,
+    function<void(const HepMC::GenParticle*, const float)> visitor
+  ) {
+
+    Interfaces::EventContext context(topNode);
+    return GetGEvtSummary(context, evtsToGrab, partonEvt, etaWindows, visitor);
+
+  }  // end 'GetGEvtSummary(PHCompositeNode*, vector<int>, optional<int>, vector<pair<float, float>>, function<void(HepMC::GenParticle*, float)>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Summarize final state particles & partons of an event using an event context
+  // --------------------------------------------------------------------------
+  /*! Walks each subevent once, accumulating
+   *  charged & neutral counts, energy & pt
+   *  sums, and counts within the provided
+   *  (min, max) eta windows. If partonEvt is
+   *  set, the outgoing partons of that
+   *  subevent are picked up along the way.
+   *  An optional visitor is called on every
+   *  final state particle (with its charge)
+   *  to accumulate further quantities.
+   */
+  Tools::GEvtSummary Tools::GetGEvtSummary(
+    Interfaces::EventContext& context,
+    const vector<int> evtsToGrab,
+    optional<int> partonEvt,
+    const vector<pair<float, float>> etaWindows,
+    function<void(const HepMC::GenParticle*, const float)> visitor
+  ) {
+
+    GEvtSummary summary;
+    summary.nParInEta.assign(etaWindows.size(), 0);
+
+    // check partons of a particle, returns true if both found
+    bool foundFirst  = false;
+    bool foundSecond = false;
+    auto checkParton = [&](const HepMC::GenParticle* particle, const int event) {
+      const int status = particle -> status();
+      if (!foundFirst && (status == Const::HardScatterStatus::First)) {
+        Types::ParInfo parton;
+        parton.SetInfo(particle, event);
+        if (parton.IsParton()) {
+          summary.partons.first = parton;
+          foundFirst            = true;
+        }
+      } else if (!foundSecond && (status == Const::HardScatterStatus::Second)) {
+        Types::ParInfo parton;
+        parton.SetInfo(particle, event);
+        if (parton.IsParton()) {
+          summary.partons.second = parton;
+          foundSecond            = true;
+        }
+      }
+      return (foundFirst && foundSecond);
+    };
+
+    // loop over subevents
+    bool didPartonEvt = false;
+    for (const int evtToGrab : evtsToGrab) {
+
+      const bool lookForPartons = (partonEvt.has_value() && (evtToGrab == partonEvt.value()));
+      didPartonEvt |= lookForPartons;
+
+      // loop over particles
+      HepMC::GenEvent* genEvt = context.GetGenEvent(evtToGrab);
+      for (
+        HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
+        particle != genEvt -> particles_end();
+        ++particle
+      ) {
+
+        // check for partons if needed
+        if (lookForPartons && !(foundFirst && foundSecond)) {
+          checkParton(*particle, evtToGrab);
+        }
+
+        // check if particle is final state
+        const bool isFinalState = Tools::IsFinalState((*particle) -> status());
+        if (!isFinalState) continue;
+
+        // accumulate sums
+        const HepMC::FourVector momentum = (*particle) -> momentum();
+        const float             charge   = Tools::GetParticleCharge((*particle) -> pdg_id());
+        if (charge != 0.) {
+          ++summary.nChrgPar;
+          summary.eSumChrg  += momentum.e();
+          summary.ptSumChrg += momentum.perp();
+        } else {
+          ++summary.nNeuPar;
+          summary.eSumNeu  += momentum.e();
+          summary.ptSumNeu += momentum.perp();
+        }
+
+        // accumulate counts in eta windows
+        if (!etaWindows.empty()) {
+          const float eta = momentum.eta();
+          for (size_t iWindow = 0; iWindow < etaWindows.size(); ++iWindow) {
+            if ((eta >= etaWindows[iWindow].first) && (eta < etaWindows[iWindow].second)) {
+              ++summary.nParInEta[iWindow];
+            }
+          }
+        }
+
+        // run any extra accumulation
+        if (visitor) visitor(*particle, charge);
+
+      }  // end particle loop
+    }  // end subevent loop
+
+    // if parton subevent wasn't among those walked, grab partons now
+    if (partonEvt.has_value() && !didPartonEvt) {
+      HepMC::GenEvent* genEvt = context.GetGenEvent(partonEvt.value());
+      for (
+        HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
+        particle != genEvt -> particles_end();
+        ++particle
+      ) {
+        if (checkParton(*particle, partonEvt.value())) break;
+      }
+    }
+    return summary;
+
+  }  // end 'GetGEvtSummary(EventContext&, vector<int>, optional<int>, vector<pair<float, float>>, function<void(HepMC::GenParticle*, float)>)'
+
 
 }  // end SColdQcdCorrelatorAnalysis namespace
 
@@ -18,7 +18,9 @@
 #include <limits>
 #include <string>
 #include <vector>
+#include <utility>
 #include <optional>
+#include <functional>
 // root libraries
 #include <Math/Vector3D.h>
 // phool libraries
@@ -45,11 +47,46 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // ------------------------------------------------------------------------
+    //! Summary of final state particles & partons in an event
+    // ------------------------------------------------------------------------
+    /*! Filled by GetGEvtSummary. Counts in
+     *  nParInEta run parallel to the provided
+     *  eta windows.
+     */
+    struct GEvtSummary {
+      int64_t                              nChrgPar  = 0;
+      int64_t                              nNeuPar   = 0;
+      double                               eSumChrg  = 0.;
+      double                               eSumNeu   = 0.;
+      double                               ptSumChrg = 0.;
+      double                               ptSumNeu  = 0.;
+      vector<int64_t>                      nParInEta;
+      pair<Types::ParInfo, Types::ParInfo> partons;
+    };
+
     // event-level generator tools --------------------------------------------
 
     int64_t        GetNumFinalStatePars(PHCompositeNode* topNode, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
+    int64_t        GetNumFinalStatePars(Interfaces::EventContext& context, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
     double         GetSumFinalStateParEne(PHCompositeNode* topNode, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
+    double         GetSumFinalStateParEne(Interfaces::EventContext& context, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
     Types::ParInfo GetPartonInfo(PHCompositeNode* topNode, const int event, const int status);
+    Types::ParInfo GetPartonInfo(Interfaces::EventContext& context, const int event, const int status);
+    GEvtSummary    GetGEvtSummary(
+      PHCompositeNode* topNode,
+      const vector<int> evtsToGrab,
+      optional<int> partonEvt = nullopt,
+      const vector<pair<float, float>> etaWindows = {},
+      function<void(const HepMC::GenParticle*, const float)> visitor = nullptr
+    );
+    GEvtSummary    GetGEvtSummary(
+      Interfaces::EventContext& context,
+      const vector<int> evtsToGrab,
+      optional<int> partonEvt = nullopt,
+      const vector<pair<float, float>> etaWindows = {},
+      function<void(const HepMC::GenParticle*, const float)> visitor = nullptr
+    );
 
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
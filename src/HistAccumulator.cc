@@ -0,0 +1,388 @@
+/// ---------------------------------------------------------------------------
+/*! \file   HistAccumulator.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Lightweight 1D/2D histogram accumulators with
+ *  O(1) binning, to be merged into ROOT histograms.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_HISTACCUMULATOR_CC
+
+// class definition
+#include "HistAccumulator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // HistAxis public methods ==================================================
+
+  // --------------------------------------------------------------------------
+  //! Check if another axis has identical binning
+  // --------------------------------------------------------------------------
+  bool Types::HistAxis::HasSameBinning(const HistAxis& other) const {
+
+    return (
+      (nBins    == other.nBins)    &&
+      (isLog    == other.isLog)    &&
+      (coordMin == other.coordMin) &&
+      (coordMax == other.coordMax)
+    );
+
+  }  // end 'HasSameBinning(HistAxis&)'
+
+
+
+  // HistAxis ctor/dtor =======================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting binning
+  // --------------------------------------------------------------------------
+  /*! For a log axis, lo and hi are the
+   *  values themselves (not their logs)
+   *  and must be positive.
+   */
+  Types::HistAxis::HistAxis(
+    const size_t bins,
+    const double lo,
+    const double hi,
+    const bool log
+  ) {
+
+    // check binning
+    if ((bins == 0) || (hi <= lo) || (log && (lo <= 0.))) {
+      cerr << PHWHERE << "PANIC: invalid axis binning: " << bins << " bins in [" << lo << ", " << hi << ")!" << endl;
+      assert((bins > 0) && (hi > lo) && (!log || (lo > 0.)));
+    }
+
+    // set binning
+    nBins    = bins;
+    isLog    = log;
+    coordMin = isLog ? log10(lo) : lo;
+    coordMax = isLog ? log10(hi) : hi;
+    invWidth = nBins / (coordMax - coordMin);
+
+    // and edges
+    edges.resize(nBins + 1);
+    for (size_t edge = 0; edge <= nBins; ++edge) {
+      const double coord = coordMin + (edge / invWidth);
+      edges[edge] = isLog ? pow(10., coord) : coord;
+    }
+
+  }  // end ctor(size_t, double, double, bool)
+
+
+
+  // HistAccumulator public methods ===========================================
+
+  // --------------------------------------------------------------------------
+  //! Clear accumulated fills
+  // --------------------------------------------------------------------------
+  void Types::HistAccumulator::Reset() {
+
+    fill(sumW.begin(), sumW.end(), 0.);
+    fill(sumW2.begin(), sumW2.end(), 0.);
+    fill(repSumW.begin(), repSumW.end(), 0.);
+    nEntries = 0;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add another accumulator with the same binning
+  // --------------------------------------------------------------------------
+  void Types::HistAccumulator::Add(const HistAccumulator& other) {
+
+    // check binning
+    const bool isCompatible = (
+      (is2D == other.is2D) &&
+      (nReplicas == other.nReplicas) &&
+      xAxis.HasSameBinning(other.xAxis) &&
+      yAxis.HasSameBinning(other.yAxis)
+    );
+    if (!isCompatible) {
+      cerr << PHWHERE << "PANIC: trying to add accumulators with different binning!" << endl;
+      assert(isCompatible);
+    }
+
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      sumW[bin]  += other.sumW[bin];
+      sumW2[bin] += other.sumW2[bin];
+    }
+    for (size_t iRep = 0; iRep < repSumW.size(); ++iRep) {
+      repSumW[iRep] += other.repSumW[iRep];
+    }
+    nEntries += other.nEntries;
+    return;
+
+  }  // end 'Add(HistAccumulator&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Turn on (or off, for 0) bootstrap replicas
+  // --------------------------------------------------------------------------
+  /*! Clears any replica contents accumulated
+   *  so far.
+   */
+  void Types::HistAccumulator::SetNReplicas(const size_t replicas) {
+
+    nReplicas = replicas;
+    repSumW.assign(sumW.size() * nReplicas, 0.);
+    return;
+
+  }  // end 'SetNReplicas(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a block of bin contents as a single entry
+  // --------------------------------------------------------------------------
+  /*! Every bin (under/overflow included) gets
+   *  contents[bin], e.g. the contents of one
+   *  jet, and its square is added to the
+   *  errors. This counts as one entry no matter
+   *  how many bins are touched. Empty bins are
+   *  skipped.
+   */
+  void Types::HistAccumulator::FillContents(const double* contents) {
+
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      if (contents[bin] == 0.) continue;
+
+      sumW[bin]  += contents[bin];
+      sumW2[bin] += contents[bin] * contents[bin];
+    }
+    ++nEntries;
+    return;
+
+  }  // end 'FillContents(double*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a block of bin contents to every replica
+  // --------------------------------------------------------------------------
+  /*! Replica r gets contents[bin] * repWgts[r]
+   *  for every bin (under/overflow included),
+   *  e.g. with the contents of one jet or
+   *  event. Only the replicas are touched, so
+   *  the contents should be filled as usual
+   *  too. Empty bins are skipped.
+   */
+  void Types::HistAccumulator::FillReplicas(const double* contents, const double* repWgts) {
+
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      if (contents[bin] == 0.) continue;
+
+      const double content = contents[bin];
+      double*      repBin  = repSumW.data() + (bin * nReplicas);
+      for (size_t replica = 0; replica < nReplicas; ++replica) {
+        repBin[replica] += content * repWgts[replica];
+      }
+    }
+    return;
+
+  }  // end 'FillReplicas(double*, double*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get the contents of a bin in a replica
+  // --------------------------------------------------------------------------
+  double Types::HistAccumulator::GetRepSumW(const size_t bin, const size_t replica) const {
+
+    return repSumW[(bin * nReplicas) + replica];
+
+  }  // end 'GetRepSumW(size_t, size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get the bootstrap error of each bin
+  // --------------------------------------------------------------------------
+  /*! Returns the standard deviation of each
+   *  bin over the replicas (0 if there are
+   *  fewer than 2 replicas).
+   */
+  vector<double> Types::HistAccumulator::GetReplicaErrors() const {
+
+    vector<double> errors(sumW.size(), 0.);
+    if (nReplicas < 2) return errors;
+
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      const double* repBin = repSumW.data() + (bin * nReplicas);
+
+      // get mean, then variance
+      double mean = 0.;
+      for (size_t replica = 0; replica < nReplicas; ++replica) {
+        mean += repBin[replica];
+      }
+      mean /= nReplicas;
+
+      double var = 0.;
+      for (size_t replica = 0; replica < nReplicas; ++replica) {
+        var += (repBin[replica] - mean) * (repBin[replica] - mean);
+      }
+      errors[bin] = sqrt(var / (nReplicas - 1));
+    }
+    return errors;
+
+  }  // end 'GetReplicaErrors()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Create a 1D histogram of the accumulated fills
+  // --------------------------------------------------------------------------
+  /*! The caller takes ownership of the
+   *  returned histogram.
+   */
+  TH1D* Types::HistAccumulator::MakeTH1D(const string& name, const string& title) const {
+
+    if (is2D) {
+      cerr << PHWHERE << "PANIC: trying to make a TH1D from a 2D accumulator!" << endl;
+      assert(!is2D);
+    }
+
+    TH1D* hist = new TH1D(name.data(), title.data(), xAxis.GetNBins(), xAxis.GetEdges().data());
+    hist -> Sumw2();
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      hist -> SetBinContent(bin, sumW[bin]);
+      hist -> SetBinError(bin, sqrt(sumW2[bin]));
+    }
+    hist -> SetEntries(nEntries);
+    return hist;
+
+  }  // end 'MakeTH1D(string&, string&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Create a 1D histogram of a bootstrap replica
+  // --------------------------------------------------------------------------
+  /*! The caller takes ownership of the
+   *  returned histogram.
+   */
+  TH1D* Types::HistAccumulator::MakeReplicaTH1D(
+    const size_t replica,
+    const string& name,
+    const string& title
+  ) const {
+
+    if (is2D || (replica >= nReplicas)) {
+      cerr << PHWHERE << "PANIC: can't make a TH1D of replica " << replica << " (" << nReplicas << " replicas)!" << endl;
+      assert(!is2D && (replica < nReplicas));
+    }
+
+    TH1D* hist = new TH1D(name.data(), title.data(), xAxis.GetNBins(), xAxis.GetEdges().data());
+    for (size_t bin = 0; bin < sumW.size(); ++bin) {
+      hist -> SetBinContent(bin, GetRepSumW(bin, replica));
+    }
+    hist -> SetEntries(nEntries);
+    return hist;
+
+  }  // end 'MakeReplicaTH1D(size_t, string&, string&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Create a 2D histogram of the accumulated fills
+  // --------------------------------------------------------------------------
+  /*! The caller takes ownership of the
+   *  returned histogram.
+   */
+  TH2D* Types::HistAccumulator::MakeTH2D(const string& name, const string& title) const {
+
+    if (!is2D) {
+      cerr << PHWHERE << "PANIC: trying to make a TH2D from a 1D accumulator!" << endl;
+      assert(is2D);
+    }
+
+    TH2D* hist = new TH2D(
+      name.data(),
+      title.data(),
+      xAxis.GetNBins(),
+      xAxis.GetEdges().data(),
+      yAxis.GetNBins(),
+      yAxis.GetEdges().data()
+    );
+    hist -> Sumw2();
+    for (size_t binY = 0; binY < yAxis.GetNBins() + 2; ++binY) {
+      for (size_t binX = 0; binX < nCellX; ++binX) {
+        const size_t bin = binX + (nCellX * binY);
+        hist -> SetBinContent(binX, binY, sumW[bin]);
+        hist -> SetBinError(binX, binY, sqrt(sumW2[bin]));
+      }
+    }
+    hist -> SetEntries(nEntries);
+    return hist;
+
+  }  // end 'MakeTH2D(string&, string&)'
+
+
+
+  // HistAccumulator static methods ===========================================
+
+  // --------------------------------------------------------------------------
+  //! Merge per-thread accumulators in a fixed order
+  // --------------------------------------------------------------------------
+  /*! Parts are summed in index order, so the
+   *  result is reproducible bit for bit for a
+   *  given set of parts.
+   */
+  Types::HistAccumulator Types::HistAccumulator::Merge(const vector<HistAccumulator>& parts) {
+
+    if (parts.empty()) return HistAccumulator();
+
+    HistAccumulator total = parts.front();
+    for (size_t part = 1; part < parts.size(); ++part) {
+      total.Add(parts[part]);
+    }
+    return total;
+
+  }  // end 'Merge(vector<HistAccumulator>&)'
+
+
+
+  // HistAccumulator ctor/dtor ================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting an x-axis (1D)
+  // --------------------------------------------------------------------------
+  Types::HistAccumulator::HistAccumulator(const HistAxis& x) {
+
+    xAxis  = x;
+    is2D   = false;
+    nCellX = xAxis.GetNBins() + 2;
+    sumW.assign(nCellX, 0.);
+    sumW2.assign(nCellX, 0.);
+
+  }  // end ctor(HistAxis&)
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting an x- and y-axis (2D)
+  // --------------------------------------------------------------------------
+  Types::HistAccumulator::HistAccumulator(const HistAxis& x, const HistAxis& y) {
+
+    xAxis  = x;
+    yAxis  = y;
+    is2D   = true;
+    nCellX = xAxis.GetNBins() + 2;
+    sumW.assign(nCellX * (yAxis.GetNBins() + 2), 0.);
+    sumW2.assign(nCellX * (yAxis.GetNBins() + 2), 0.);
+
+  }  // end ctor(HistAxis&, HistAxis&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
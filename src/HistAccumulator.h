@@ -0,0 +1,206 @@
+/// ---------------------------------------------------------------------------
+/*! \file   HistAccumulator.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Lightweight 1D/2D histogram accumulators with
+ *  O(1) binning, to be merged into ROOT histograms.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_HISTACCUMULATOR_H
+#define SCORRELATORUTILITIES_HISTACCUMULATOR_H
+
+// c++ utilities
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+// root libraries
+#include <TH1D.h>
+#include <TH2D.h>
+// phool libraries
+#include <phool/phool.h>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Uniform or log-spaced axis with O(1) bin lookup
+    // ------------------------------------------------------------------------
+    /*! Bins are found arithmetically rather than
+     *  by searching the edges. For a log axis,
+     *  the "coordinate" is log10(value), so
+     *  callers which already have the log (e.g.
+     *  from an earlier pass) can skip it via
+     *  GetBinFromCoordinate(). Bin 0 is underflow
+     *  (including NaN) and nBins + 1 overflow, as
+     *  in ROOT.
+     */
+    class HistAxis {
+
+      private:
+
+        // data members
+        size_t         nBins    = 0;
+        bool           isLog    = false;
+        double         coordMin = 0.;
+        double         coordMax = 0.;
+        double         invWidth = 0.;
+        vector<double> edges;
+
+      public:
+
+        // getters
+        size_t                GetNBins()    const {return nBins;}
+        bool                  GetIsLog()    const {return isLog;}
+        double                GetCoordMin() const {return coordMin;}
+        double                GetCoordMax() const {return coordMax;}
+        const vector<double>& GetEdges()    const {return edges;}
+
+        // inline public methods
+        size_t GetBinFromCoordinate(const double coord) const {
+          if (!(coord >= coordMin)) return 0;
+          if (coord >= coordMax)    return nBins + 1;
+          return min((size_t) ((coord - coordMin) * invWidth), nBins - 1) + 1;
+        }
+        size_t GetBin(const double value) const {
+          return GetBinFromCoordinate(isLog ? log10(value) : value);
+        }
+
+        // public methods
+        bool HasSameBinning(const HistAxis& other) const;
+
+        // default ctor/dtor
+        HistAxis()  {};
+        ~HistAxis() {};
+
+        // ctor accepting arguments
+        HistAxis(const size_t bins, const double lo, const double hi, const bool log = false);
+
+    };  // end HistAxis def
+
+
+
+    // ------------------------------------------------------------------------
+    //! Histogram accumulator for single-thread fills
+    // ------------------------------------------------------------------------
+    /*! Holds plain arrays of sum(w) and sum(w^2)
+     *  per bin (under/overflow included), so a
+     *  fill is a bin lookup and two adds. Meant
+     *  to be owned by one thread, e.g.
+     *
+     *    vector<HistAccumulator> perThread(nThreads, HistAccumulator(axis));
+     *    // ... thread i only fills perThread[i] ...
+     *    HistAccumulator total = HistAccumulator::Merge(perThread);
+     *    TH1D* hist = total.MakeTH1D("hEEC");
+     *
+     *  Merge() adds the parts in index order, so
+     *  the result doesn't depend on how threads
+     *  were scheduled. A 2D accumulator is made by
+     *  passing a y-axis.
+     *
+     *  Bootstrap replicas (see BootstrapWeights)
+     *  can be carried along: after SetNReplicas(),
+     *  the fills taking replica weights also add
+     *  wgt * repWgts[r] to each replica, stored
+     *  bin-major so the per-bin update over all
+     *  replicas is one contiguous loop.
+     */
+    class HistAccumulator {
+
+      private:
+
+        // binning
+        HistAxis xAxis;
+        HistAxis yAxis;
+        bool     is2D   = false;
+        size_t   nCellX = 0;
+
+        // accumulators
+        vector<double> sumW;
+        vector<double> sumW2;
+        uint64_t       nEntries = 0;
+
+        // bootstrap replicas (index is bin * nReplicas + replica)
+        size_t         nReplicas = 0;
+        vector<double> repSumW;
+
+      public:
+
+        // getters
+        bool                  GetIs2D()      const {return is2D;}
+        uint64_t              GetNEntries()  const {return nEntries;}
+        const HistAxis&       GetXAxis()     const {return xAxis;}
+        const HistAxis&       GetYAxis()     const {return yAxis;}
+        const vector<double>& GetSumW()      const {return sumW;}
+        const vector<double>& GetSumW2()     const {return sumW2;}
+        size_t                GetNReplicas() const {return nReplicas;}
+        const vector<double>& GetRepSumW()   const {return repSumW;}
+
+        // inline public methods
+        void FillBin(const size_t bin, const double wgt = 1.) {
+          sumW[bin]  += wgt;
+          sumW2[bin] += wgt * wgt;
+          ++nEntries;
+        }
+        void FillBin(const size_t binX, const size_t binY, const double wgt) {
+          FillBin(binX + (nCellX * binY), wgt);
+        }
+        void Fill(const double x, const double wgt = 1.) {
+          FillBin(xAxis.GetBin(x), wgt);
+        }
+        void Fill(const double x, const double y, const double wgt) {
+          FillBin(xAxis.GetBin(x), yAxis.GetBin(y), wgt);
+        }
+        void FillBin(const size_t bin, const double wgt, const double* repWgts) {
+          FillBin(bin, wgt);
+          double* repBin = repSumW.data() + (bin * nReplicas);
+          for (size_t replica = 0; replica < nReplicas; ++replica) {
+            repBin[replica] += wgt * repWgts[replica];
+          }
+        }
+        void Fill(const double x, const double wgt, const double* repWgts) {
+          FillBin(xAxis.GetBin(x), wgt, repWgts);
+        }
+
+        // public methods
+        void           Reset();
+        void           Add(const HistAccumulator& other);
+        void           SetNReplicas(const size_t replicas);
+        void           FillContents(const double* contents);
+        void           FillReplicas(const double* contents, const double* repWgts);
+        double         GetRepSumW(const size_t bin, const size_t replica) const;
+        vector<double> GetReplicaErrors() const;
+        TH1D*          MakeTH1D(const string& name, const string& title = "") const;
+        TH1D*          MakeReplicaTH1D(const size_t replica, const string& name, const string& title = "") const;
+        TH2D*          MakeTH2D(const string& name, const string& title = "") const;
+
+        // static methods
+        static HistAccumulator Merge(const vector<HistAccumulator>& parts);
+
+        // default ctor/dtor
+        HistAccumulator()  {};
+        ~HistAccumulator() {};
+
+        // ctors accepting arguments
+        HistAccumulator(const HistAxis& x);
+        HistAccumulator(const HistAxis& x, const HistAxis& y);
+
+    };  // end HistAccumulator def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -12,12 +12,14 @@
 
 #include "ClustInterfaces.h"
 #include "CstInterfaces.h"
+#include "EventContext.h"
 #include "FlowInterfaces.h"
 #include "NodeInterfaces.h"
 #include "ParInterfaces.h"
 #include "TreeInterfaces.h"
 #include "TrkInterfaces.h"
 #include "TupleInterfaces.h"
+#include "TwrGeoTable.h"
 #include "TwrInterfaces.h"
 #include "VtxInterfaces.h"
 
@@ -0,0 +1,240 @@
+/// ---------------------------------------------------------------------------
+/*! \file   JetColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for jet info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_JETCOLUMNS_CC
+
+// class definition
+#include "JetColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a JetInfo
+  // --------------------------------------------------------------------------
+  Types::JetInfo Types::JetColumns::GetInfo(const size_t row) const {
+
+    JetInfo info;
+    info.SetJetID( jetID[row] );
+    info.SetNCsts( nCsts[row] );
+    info.SetEne( ene[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetPT( pt[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    info.SetArea( area[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of JetInfo
+  // --------------------------------------------------------------------------
+  vector<Types::JetInfo> Types::JetColumns::GetInfos() const {
+
+    vector<JetInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a JetInfo
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::SetRow(const size_t row, const JetInfo& info) {
+
+    jetID[row] = info.GetJetID();
+    nCsts[row] = info.GetNCsts();
+    ene  [row] = info.GetEne();
+    px   [row] = info.GetPX();
+    py   [row] = info.GetPY();
+    pz   [row] = info.GetPZ();
+    pt   [row] = info.GetPT();
+    eta  [row] = info.GetEta();
+    phi  [row] = info.GetPhi();
+    area [row] = info.GetArea();
+    return;
+
+  }  // end 'SetRow(size_t, JetInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of JetInfo
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::SetInfos(const vector<JetInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const JetInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<JetInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a JetInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::Append(const JetInfo& info) {
+
+    jetID.push_back( info.GetJetID() );
+    nCsts.push_back( info.GetNCsts() );
+    ene  .push_back( info.GetEne() );
+    px   .push_back( info.GetPX() );
+    py   .push_back( info.GetPY() );
+    pz   .push_back( info.GetPZ() );
+    pt   .push_back( info.GetPT() );
+    eta  .push_back( info.GetEta() );
+    phi  .push_back( info.GetPhi() );
+    area .push_back( info.GetArea() );
+    return;
+
+  }  // end 'Append(JetInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::Reserve(const size_t size) {
+
+    jetID.reserve(size);
+    nCsts.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    area.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed JetInfo.
+   */
+  void Types::JetColumns::Resize(const size_t size) {
+
+    jetID.resize(size, numeric_limits<uint32_t>::max());
+    nCsts.resize(size, numeric_limits<uint64_t>::max());
+    ene  .resize(size, numeric_limits<double>::max());
+    px   .resize(size, numeric_limits<double>::max());
+    py   .resize(size, numeric_limits<double>::max());
+    pz   .resize(size, numeric_limits<double>::max());
+    pt   .resize(size, numeric_limits<double>::max());
+    eta  .resize(size, numeric_limits<double>::max());
+    phi  .resize(size, numeric_limits<double>::max());
+    area .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::Reset() {
+
+    jetID.clear();
+    nCsts.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    eta.clear();
+    phi.clear();
+    area.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::JetColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&ene, &px, &py, &pz, &pt, &eta, &phi, &area}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::JetColumns::JetColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::JetColumns::~JetColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of JetInfo
+  // --------------------------------------------------------------------------
+  Types::JetColumns::JetColumns(const vector<JetInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<JetInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
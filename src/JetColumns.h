@@ -0,0 +1,151 @@
+/// ---------------------------------------------------------------------------
+/*! \file   JetColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for jet info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_JETCOLUMNS_H
+#define SCORRELATORUTILITIES_JETCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "JetInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Jet info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to JetInfo:
+     *  each member of JetInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  jets only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  JetInfo. As in JetInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class JetColumns {
+
+      private:
+
+        // data members
+        vector<uint32_t>   jetID;
+        vector<uint64_t>   nCsts;
+        vector<Double32_t> ene;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> pt;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> area;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as JetInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const JetColumns* columns = nullptr;  //!
+            size_t            index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t   GetIndex() const {return index;}
+            uint32_t GetJetID() const {return columns -> jetID[index];}
+            uint64_t GetNCsts() const {return columns -> nCsts[index];}
+            double   GetEne()   const {return columns -> ene[index];}
+            double   GetPX()    const {return columns -> px[index];}
+            double   GetPY()    const {return columns -> py[index];}
+            double   GetPZ()    const {return columns -> pz[index];}
+            double   GetPT()    const {return columns -> pt[index];}
+            double   GetEta()   const {return columns -> eta[index];}
+            double   GetPhi()   const {return columns -> phi[index];}
+            double   GetArea()  const {return columns -> area[index];}
+
+            // conversion to JetInfo
+            JetInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator JetInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const JetColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<uint32_t>& GetJetID() const {return jetID;}
+        const vector<uint64_t>& GetNCsts() const {return nCsts;}
+        const vector<double>&   GetEne()   const {return ene;}
+        const vector<double>&   GetPX()    const {return px;}
+        const vector<double>&   GetPY()    const {return py;}
+        const vector<double>&   GetPZ()    const {return pz;}
+        const vector<double>&   GetPT()    const {return pt;}
+        const vector<double>&   GetEta()   const {return eta;}
+        const vector<double>&   GetPhi()   const {return phi;}
+        const vector<double>&   GetArea()  const {return area;}
+
+        // public methods
+        size_t          GetSize() const {return jetID.size();}
+        bool            IsEmpty() const {return jetID.empty();}
+        Row             GetRow(const size_t row) const {return Row(this, row);}
+        JetInfo         GetInfo(const size_t row) const;
+        vector<JetInfo> GetInfos() const;
+        void            SetRow(const size_t row, const JetInfo& info);
+        void            SetInfos(const vector<JetInfo>& infos);
+        void            Append(const JetInfo& info);
+        void            Reserve(const size_t size);
+        void            Resize(const size_t size);
+        void            Reset();
+        void            RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        JetColumns();
+        ~JetColumns();
+
+        // ctor accepting arguments
+        JetColumns(const vector<JetInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(JetColumns, 2)
+
+    };  // end JetColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
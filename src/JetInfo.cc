@@ -137,6 +137,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::JetInfo::RestoreLimits() {
+
+    for (double* member : {&ene, &px, &py, &pz, &pt, &eta, &phi, &area}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
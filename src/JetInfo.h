@@ -11,6 +11,7 @@
 #define SCORRELATORUTILITIES_JETINFO_H
 
 // c++ utilities
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
@@ -44,16 +45,16 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        uint32_t jetID = numeric_limits<uint32_t>::max();
-        uint64_t nCsts = numeric_limits<uint64_t>::max();
-        double   ene   = numeric_limits<double>::max();
-        double   px    = numeric_limits<double>::max();
-        double   py    = numeric_limits<double>::max();
-        double   pz    = numeric_limits<double>::max();
-        double   pt    = numeric_limits<double>::max();
-        double   eta   = numeric_limits<double>::max();
-        double   phi   = numeric_limits<double>::max();
-        double   area  = numeric_limits<double>::max();
+        uint32_t   jetID = numeric_limits<uint32_t>::max();
+        uint64_t   nCsts = numeric_limits<uint64_t>::max();
+        Double32_t ene   = numeric_limits<double>::max();
+        Double32_t px    = numeric_limits<double>::max();
+        Double32_t py    = numeric_limits<double>::max();
+        Double32_t pz    = numeric_limits<double>::max();
+        Double32_t pt    = numeric_limits<double>::max();
+        Double32_t eta   = numeric_limits<double>::max();
+        Double32_t phi   = numeric_limits<double>::max();
+        Double32_t area  = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -91,6 +92,7 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(Jet& jet);
         bool IsInAcceptance(const JetInfo& minimum, const JetInfo& maximum) const;
         bool IsInAcceptance(const pair<JetInfo, JetInfo>& range) const;
+        void RestoreLimits();
 
         // static methods
         static vector<string> GetListOfMembers();
@@ -111,7 +113,7 @@ namespace SColdQcdCorrelatorAnalysis {
         JetInfo(Jet& jet);
 
       // identify this class to ROOT
-      ClassDefNV(JetInfo, 1)
+      ClassDefNV(JetInfo, 2)
 
     };  // end JetInfo def
 
@@ -18,6 +18,15 @@ using namespace findNode;
 
 
 
+namespace {
+
+  // generation of current event on this thread
+  thread_local uint64_t eventGeneration = 0;
+
+}  // end anonymous namespace
+
+
+
 // node interfaces ============================================================
 
 namespace SColdQcdCorrelatorAnalysis {
@@ -39,6 +48,52 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Get sequence number of current event
+  // --------------------------------------------------------------------------
+  /*! Returns nullopt if there is no EventHeader
+   *  node to read the sequence number from.
+   */
+  optional<int> Interfaces::GetEventSequence(PHCompositeNode* topNode) {
+
+    EventHeader* header = getClass<EventHeader>(topNode, "EventHeader");
+    if (!header) {
+      return nullopt;
+    }
+    return header -> get_EvtSequence();
+
+  }  // end 'GetEventSequence(PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) generation of the current event
+  // --------------------------------------------------------------------------
+  /*! The generation is bumped every time an
+   *  EventContext is created or reset, so it
+   *  (unlike the event sequence number) never
+   *  repeats. It's 0 until the first context
+   *  on this thread is made.
+   */
+  uint64_t Interfaces::GetEventGeneration() {
+
+    return eventGeneration;
+
+  }  // end 'GetEventGeneration()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Start a new (per-thread) event generation
+  // --------------------------------------------------------------------------
+  uint64_t Interfaces::NextEventGeneration() {
+
+    return ++eventGeneration;
+
+  }  // end 'NextEventGeneration()'
+
+
+
   // --------------------------------------------------------------------------
   //! Create node
   // --------------------------------------------------------------------------
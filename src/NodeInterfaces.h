@@ -12,6 +12,8 @@
 
 // c++ utilities
 #include <string>
+#include <cstdint>
+#include <optional>
 // phool libraries
 #include <phool/phool.h>
 #include <phool/getClass.h>
@@ -19,6 +21,8 @@
 #include <phool/PHIODataNode.h>
 #include <phool/PHNodeIterator.h>
 #include <phool/PHCompositeNode.h>
+// fun4all object libraries
+#include <ffaobjects/EventHeader.h>
 // analysis utilities
 #include "Constants.h"
 
@@ -32,7 +36,10 @@ namespace SColdQcdCorrelatorAnalysis {
 
     // node interfaces --------------------------------------------------------
 
-    void CleanseNodeName(string& nameToClean);
+    void          CleanseNodeName(string& nameToClean);
+    optional<int> GetEventSequence(PHCompositeNode* topNode);
+    uint64_t      GetEventGeneration();
+    uint64_t      NextEventGeneration();
 
     // generic methods
     template <typename T> void CreateNode(PHCompositeNode* topNode, string newNodeName, T& objectInNode);
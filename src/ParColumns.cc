@@ -0,0 +1,282 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ParColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for particle info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_PARCOLUMNS_CC
+
+// class definition
+#include "ParColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a ParInfo
+  // --------------------------------------------------------------------------
+  Types::ParInfo Types::ParColumns::GetInfo(const size_t row) const {
+
+    ParInfo info;
+    info.SetPID( pid[row] );
+    info.SetStatus( status[row] );
+    info.SetBarcode( barcode[row] );
+    info.SetEmbedID( embedID[row] );
+    info.SetCharge( charge[row] );
+    info.SetMass( mass[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    info.SetEne( ene[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetPT( pt[row] );
+    info.SetVX( vx[row] );
+    info.SetVY( vy[row] );
+    info.SetVZ( vz[row] );
+    info.SetVR( vr[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of ParInfo
+  // --------------------------------------------------------------------------
+  vector<Types::ParInfo> Types::ParColumns::GetInfos() const {
+
+    vector<ParInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a ParInfo
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::SetRow(const size_t row, const ParInfo& info) {
+
+    pid    [row] = info.GetPID();
+    status [row] = info.GetStatus();
+    barcode[row] = info.GetBarcode();
+    embedID[row] = info.GetEmbedID();
+    charge [row] = info.GetCharge();
+    mass   [row] = info.GetMass();
+    eta    [row] = info.GetEta();
+    phi    [row] = info.GetPhi();
+    ene    [row] = info.GetEne();
+    px     [row] = info.GetPX();
+    py     [row] = info.GetPY();
+    pz     [row] = info.GetPZ();
+    pt     [row] = info.GetPT();
+    vx     [row] = info.GetVX();
+    vy     [row] = info.GetVY();
+    vz     [row] = info.GetVZ();
+    vr     [row] = info.GetVR();
+    return;
+
+  }  // end 'SetRow(size_t, ParInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of ParInfo
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::SetInfos(const vector<ParInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const ParInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<ParInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a ParInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::Append(const ParInfo& info) {
+
+    pid    .push_back( info.GetPID() );
+    status .push_back( info.GetStatus() );
+    barcode.push_back( info.GetBarcode() );
+    embedID.push_back( info.GetEmbedID() );
+    charge .push_back( info.GetCharge() );
+    mass   .push_back( info.GetMass() );
+    eta    .push_back( info.GetEta() );
+    phi    .push_back( info.GetPhi() );
+    ene    .push_back( info.GetEne() );
+    px     .push_back( info.GetPX() );
+    py     .push_back( info.GetPY() );
+    pz     .push_back( info.GetPZ() );
+    pt     .push_back( info.GetPT() );
+    vx     .push_back( info.GetVX() );
+    vy     .push_back( info.GetVY() );
+    vz     .push_back( info.GetVZ() );
+    vr     .push_back( info.GetVR() );
+    return;
+
+  }  // end 'Append(ParInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::Reserve(const size_t size) {
+
+    pid.reserve(size);
+    status.reserve(size);
+    barcode.reserve(size);
+    embedID.reserve(size);
+    charge.reserve(size);
+    mass.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    vx.reserve(size);
+    vy.reserve(size);
+    vz.reserve(size);
+    vr.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed ParInfo.
+   */
+  void Types::ParColumns::Resize(const size_t size) {
+
+    pid    .resize(size, numeric_limits<int>::max());
+    status .resize(size, numeric_limits<int>::max());
+    barcode.resize(size, numeric_limits<int>::max());
+    embedID.resize(size, numeric_limits<int>::max());
+    charge .resize(size, numeric_limits<float>::max());
+    mass   .resize(size, numeric_limits<double>::max());
+    eta    .resize(size, numeric_limits<double>::max());
+    phi    .resize(size, numeric_limits<double>::max());
+    ene    .resize(size, numeric_limits<double>::max());
+    px     .resize(size, numeric_limits<double>::max());
+    py     .resize(size, numeric_limits<double>::max());
+    pz     .resize(size, numeric_limits<double>::max());
+    pt     .resize(size, numeric_limits<double>::max());
+    vx     .resize(size, numeric_limits<double>::max());
+    vy     .resize(size, numeric_limits<double>::max());
+    vz     .resize(size, numeric_limits<double>::max());
+    vr     .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::Reset() {
+
+    pid.clear();
+    status.clear();
+    barcode.clear();
+    embedID.clear();
+    charge.clear();
+    mass.clear();
+    eta.clear();
+    phi.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    vx.clear();
+    vy.clear();
+    vz.clear();
+    vr.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::ParColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&mass, &eta, &phi, &ene, &px, &py, &pz, &pt, &vx, &vy, &vz, &vr}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::ParColumns::ParColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::ParColumns::~ParColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of ParInfo
+  // --------------------------------------------------------------------------
+  Types::ParColumns::ParColumns(const vector<ParInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<ParInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
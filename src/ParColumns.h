@@ -0,0 +1,172 @@
+/// ---------------------------------------------------------------------------
+/*! \file   ParColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for particle info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_PARCOLUMNS_H
+#define SCORRELATORUTILITIES_PARCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "ParInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Particle info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to ParInfo:
+     *  each member of ParInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  generated particles only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  ParInfo. As in ParInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class ParColumns {
+
+      private:
+
+        // data members
+        vector<int>        pid;
+        vector<int>        status;
+        vector<int>        barcode;
+        vector<int>        embedID;
+        vector<float>      charge;
+        vector<Double32_t> mass;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> ene;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> pt;
+        vector<Double32_t> vx;
+        vector<Double32_t> vy;
+        vector<Double32_t> vz;
+        vector<Double32_t> vr;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as ParInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const ParColumns* columns = nullptr;  //!
+            size_t            index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t GetIndex()   const {return index;}
+            int    GetPID()     const {return columns -> pid[index];}
+            int    GetStatus()  const {return columns -> status[index];}
+            int    GetBarcode() const {return columns -> barcode[index];}
+            int    GetEmbedID() const {return columns -> embedID[index];}
+            float  GetCharge()  const {return columns -> charge[index];}
+            double GetMass()    const {return columns -> mass[index];}
+            double GetEta()     const {return columns -> eta[index];}
+            double GetPhi()     const {return columns -> phi[index];}
+            double GetEne()     const {return columns -> ene[index];}
+            double GetPX()      const {return columns -> px[index];}
+            double GetPY()      const {return columns -> py[index];}
+            double GetPZ()      const {return columns -> pz[index];}
+            double GetPT()      const {return columns -> pt[index];}
+            double GetVX()      const {return columns -> vx[index];}
+            double GetVY()      const {return columns -> vy[index];}
+            double GetVZ()      const {return columns -> vz[index];}
+            double GetVR()      const {return columns -> vr[index];}
+
+            // conversion to ParInfo
+            ParInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator ParInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const ParColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&    GetPID()     const {return pid;}
+        const vector<int>&    GetStatus()  const {return status;}
+        const vector<int>&    GetBarcode() const {return barcode;}
+        const vector<int>&    GetEmbedID() const {return embedID;}
+        const vector<float>&  GetCharge()  const {return charge;}
+        const vector<double>& GetMass()    const {return mass;}
+        const vector<double>& GetEta()     const {return eta;}
+        const vector<double>& GetPhi()     const {return phi;}
+        const vector<double>& GetEne()     const {return ene;}
+        const vector<double>& GetPX()      const {return px;}
+        const vector<double>& GetPY()      const {return py;}
+        const vector<double>& GetPZ()      const {return pz;}
+        const vector<double>& GetPT()      const {return pt;}
+        const vector<double>& GetVX()      const {return vx;}
+        const vector<double>& GetVY()      const {return vy;}
+        const vector<double>& GetVZ()      const {return vz;}
+        const vector<double>& GetVR()      const {return vr;}
+
+        // public methods
+        size_t          GetSize() const {return pid.size();}
+        bool            IsEmpty() const {return pid.empty();}
+        Row             GetRow(const size_t row) const {return Row(this, row);}
+        ParInfo         GetInfo(const size_t row) const;
+        vector<ParInfo> GetInfos() const;
+        void            SetRow(const size_t row, const ParInfo& info);
+        void            SetInfos(const vector<ParInfo>& infos);
+        void            Append(const ParInfo& info);
+        void            Reserve(const size_t size);
+        void            Resize(const size_t size);
+        void            Reset();
+        void            RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        ParColumns();
+        ~ParColumns();
+
+        // ctor accepting arguments
+        ParColumns(const vector<ParInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(ParColumns, 2)
+
+    };  // end ParColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -101,7 +101,7 @@ namespace SColdQcdCorrelatorAnalysis {
     status  = particle -> status();
     barcode = particle -> barcode();
     embedID = event;
-    charge  = Const::MapPidOntoCharge()[pid];
+    charge  = Const::PidOntoCharge(pid);
     mass    = particle -> momentum().m();
     eta     = particle -> momentum().eta();
     phi     = particle -> momentum().phi();
@@ -126,7 +126,7 @@ namespace SColdQcdCorrelatorAnalysis {
     status  = numeric_limits<int>::max();  // FIXME there must be a way to get the status of these particles
     barcode = particle -> get_barcode();
     embedID = event;
-    charge  = Const::MapPidOntoCharge()[pid];
+    charge  = Const::PidOntoCharge(pid);
     mass    = numeric_limits<double>::max();  // FIXME likewise for mass
     ene     = particle -> get_e();
     px      = particle -> get_px();
@@ -195,12 +195,15 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   //! Check if particle is a parton
   // --------------------------------------------------------------------------
+  /*! Anti-quarks (negative PIDs) are partons too.
+   */
   bool Types::ParInfo::IsParton() const {
 
-    const bool isLightQuark   = ((pid == Const::Parton::Down)    || (pid == Const::Parton::Up));
-    const bool isStrangeQuark = ((pid == Const::Parton::Strange) || (pid == Const::Parton::Charm));
-    const bool isHeavyQuark   = ((pid == Const::Parton::Bottom)  || (pid == Const::Parton::Top));
-    const bool isGluon        = (pid == Const::Parton::Gluon);
+    const int  absPid         = abs(pid);
+    const bool isLightQuark   = ((absPid == Const::Parton::Down)    || (absPid == Const::Parton::Up));
+    const bool isStrangeQuark = ((absPid == Const::Parton::Strange) || (absPid == Const::Parton::Charm));
+    const bool isHeavyQuark   = ((absPid == Const::Parton::Bottom)  || (absPid == Const::Parton::Top));
+    const bool isGluon        = (absPid == Const::Parton::Gluon);
     return (isLightQuark || isStrangeQuark || isHeavyQuark || isGluon);
 
   }  // end 'IsParton()'
@@ -218,6 +221,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::ParInfo::RestoreLimits() {
+
+    for (double* member : {&mass, &eta, &phi, &ene, &px, &py, &pz, &pt, &vx, &vy, &vz, &vr}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
 // c++ utilities
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
@@ -52,23 +53,23 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int    pid     = numeric_limits<int>::max();
-        int    status  = numeric_limits<int>::max();
-        int    barcode = numeric_limits<int>::max();
-        int    embedID = numeric_limits<int>::max();
-        float  charge  = numeric_limits<float>::max();
-        double mass    = numeric_limits<double>::max();
-        double eta     = numeric_limits<double>::max();
-        double phi     = numeric_limits<double>::max();
-        double ene     = numeric_limits<double>::max();
-        double px      = numeric_limits<double>::max();
-        double py      = numeric_limits<double>::max();
-        double pz      = numeric_limits<double>::max();
-        double pt      = numeric_limits<double>::max();
-        double vx      = numeric_limits<double>::max();
-        double vy      = numeric_limits<double>::max();
-        double vz      = numeric_limits<double>::max();
-        double vr      = numeric_limits<double>::max();
+        int        pid     = numeric_limits<int>::max();
+        int        status  = numeric_limits<int>::max();
+        int        barcode = numeric_limits<int>::max();
+        int        embedID = numeric_limits<int>::max();
+        float      charge  = numeric_limits<float>::max();
+        Double32_t mass    = numeric_limits<double>::max();
+        Double32_t eta     = numeric_limits<double>::max();
+        Double32_t phi     = numeric_limits<double>::max();
+        Double32_t ene     = numeric_limits<double>::max();
+        Double32_t px      = numeric_limits<double>::max();
+        Double32_t py      = numeric_limits<double>::max();
+        Double32_t pz      = numeric_limits<double>::max();
+        Double32_t pt      = numeric_limits<double>::max();
+        Double32_t vx      = numeric_limits<double>::max();
+        Double32_t vy      = numeric_limits<double>::max();
+        Double32_t vz      = numeric_limits<double>::max();
+        Double32_t vr      = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -120,6 +121,7 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(const PHG4Particle* particle, const int event);
         bool IsInAcceptance(const ParInfo& minimum, const ParInfo& maximum) const;
         bool IsInAcceptance(const pair<ParInfo, ParInfo>& range) const;
+        void RestoreLimits();
         bool IsFinalState() const;
         bool IsHardScatterProduct() const;
         bool IsParton() const;
@@ -144,7 +146,7 @@ namespace SColdQcdCorrelatorAnalysis {
         ParInfo(PHG4Particle* particle, const int event);
 
       // identify this class to ROOT
-      ClassDefNV(ParInfo, 1)
+      ClassDefNV(ParInfo, 2)
 
     };  // end ParInfo definition
 
@@ -75,8 +75,18 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   PHHepMCGenEvent* Interfaces::GetMcEvent(PHCompositeNode* topNode, const int iEvtToGrab) {
 
-    PHHepMCGenEventMap* mcEvtMap = GetMcEventMap(topNode);
-    PHHepMCGenEvent*    mcEvt    = mcEvtMap -> get(iEvtToGrab);
+    return GetMcEvent(GetMcEventMap(topNode), iEvtToGrab);
+
+  }  // end 'GetMcEvent(PHCompositeNode*, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific HepMC event from a provided event map
+  // --------------------------------------------------------------------------
+  PHHepMCGenEvent* Interfaces::GetMcEvent(PHHepMCGenEventMap* mcEvtMap, const int iEvtToGrab) {
+
+    PHHepMCGenEvent* mcEvt = mcEvtMap -> get(iEvtToGrab);
     if (!mcEvt) {
       cerr << PHWHERE
            << "PANIC: Couldn't grab mc event!"
@@ -85,7 +95,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return mcEvt;
 
-  }  // end 'GetMcEvent(PHCompositeNode*, int)'
+  }  // end 'GetMcEvent(PHHepMCGenEventMap*, int)'
 
 
 
@@ -94,7 +104,18 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   HepMC::GenEvent* Interfaces::GetGenEvent(PHCompositeNode* topNode, const int iEvtToGrab) {
 
-    PHHepMCGenEvent* mcEvt  = GetMcEvent(topNode, iEvtToGrab);
+    return GetGenEvent(GetMcEventMap(topNode), iEvtToGrab);
+
+  }  // end 'GetGenEvent(PHCompositeNode*, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get the corresponding GenEvt object from a provided event map
+  // --------------------------------------------------------------------------
+  HepMC::GenEvent* Interfaces::GetGenEvent(PHHepMCGenEventMap* mcEvtMap, const int iEvtToGrab) {
+
+    PHHepMCGenEvent* mcEvt  = GetMcEvent(mcEvtMap, iEvtToGrab);
     HepMC::GenEvent* genEvt = mcEvt -> getEvent();
     if (!genEvt) {
       cerr << PHWHERE
@@ -104,7 +125,206 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return genEvt;
 
-  }  // end 'GetGenEvent(PHCompositeNode*, int)'
+  }  // end 'GetGenEvent(PHHepMCGenEventMap*, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear barcode index
+  // --------------------------------------------------------------------------
+  void Interfaces::ResetHepMCBarcodeIndex() {
+
+    GetHepMCBarcodeIndex().Reset();
+    return;
+
+  }  // end 'ResetHepMCBarcodeIndex()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) barcode index
+  // --------------------------------------------------------------------------
+  Interfaces::HepMCBarcodeIndex& Interfaces::GetHepMCBarcodeIndex() {
+
+    thread_local HepMCBarcodeIndex index;
+    return index;
+
+  }  // end 'GetHepMCBarcodeIndex()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get barcode index for an event, (re)building it if needed
+  // --------------------------------------------------------------------------
+  const Interfaces::HepMCBarcodeIndex& Interfaces::GetHepMCBarcodeIndex(PHHepMCGenEventMap* mcEvtMap, const int event) {
+
+    HepMCBarcodeIndex& index = GetHepMCBarcodeIndex();
+    if (!index.IsCurrent(event, mcEvtMap, mcEvtMap -> size())) {
+      index.Build(mcEvtMap, event);
+    }
+    return index;
+
+  }  // end 'GetHepMCBarcodeIndex(PHHepMCGenEventMap*, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear particle index
+  // --------------------------------------------------------------------------
+  void Interfaces::ResetPHG4ParticleIndex() {
+
+    GetPHG4ParticleIndex().Reset();
+    return;
+
+  }  // end 'ResetPHG4ParticleIndex()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) particle index
+  // --------------------------------------------------------------------------
+  Interfaces::PHG4ParticleIndex& Interfaces::GetPHG4ParticleIndex() {
+
+    thread_local PHG4ParticleIndex index;
+    return index;
+
+  }  // end 'GetPHG4ParticleIndex()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get particle index for an event, (re)building it if needed
+  // --------------------------------------------------------------------------
+  const Interfaces::PHG4ParticleIndex& Interfaces::GetPHG4ParticleIndex(PHG4TruthInfoContainer* container, const int event) {
+
+    PHG4ParticleIndex& index = GetPHG4ParticleIndex();
+    if (!index.IsCurrent(event, container, container -> GetMap().size())) {
+      index.Build(container, event);
+    }
+    return index;
+
+  }  // end 'GetPHG4ParticleIndex(PHG4TruthInfoContainer*, int)'
+
+
+
+  // barcode index methods ====================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear index
+  // --------------------------------------------------------------------------
+  void Interfaces::HepMCBarcodeIndex::Reset() {
+
+    generation = 0;
+    event      = numeric_limits<int>::min();
+    size       = 0;
+    store      = nullptr;
+    table.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill index from all subevents in an event map
+  // --------------------------------------------------------------------------
+  void Interfaces::HepMCBarcodeIndex::Build(PHHepMCGenEventMap* mcEvtMap, const int evt) {
+
+    Reset();
+    generation = GetEventGeneration();
+    event      = evt;
+    store      = mcEvtMap;
+    size       = mcEvtMap -> size();
+
+    // reserve space for all particles up front
+    size_t nPar = 0;
+    for (
+      PHHepMCGenEventMap::ConstIter genEvt = mcEvtMap -> begin();
+      genEvt != mcEvtMap -> end();
+      ++genEvt
+    ) {
+      nPar += genEvt -> second -> getEvent() -> particles_size();
+    }
+    table.reserve(nPar);
+
+    // now add particles
+    for (
+      PHHepMCGenEventMap::ConstIter genEvt = mcEvtMap -> begin();
+      genEvt != mcEvtMap -> end();
+      ++genEvt
+    ) {
+      for (
+        HepMC::GenEvent::particle_const_iterator hepPar = genEvt -> second -> getEvent() -> particles_begin();
+        hepPar != genEvt -> second -> getEvent() -> particles_end();
+        ++hepPar
+      ) {
+        table.emplace(
+          (*hepPar) -> barcode(),
+          make_pair(genEvt -> first, *hepPar)
+        );
+      }  // end particle loop
+    }  // end subevent loop
+    return;
+
+  }  // end 'Build(PHHepMCGenEventMap*, int)'
+
+
+
+  // particle index methods ===================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear index
+  // --------------------------------------------------------------------------
+  void Interfaces::PHG4ParticleIndex::Reset() {
+
+    generation = 0;
+    event      = numeric_limits<int>::min();
+    size       = 0;
+    store      = nullptr;
+    minID      = 0;
+    byTrack.clear();
+    byBarcode.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill index from all particles in a truth container
+  // --------------------------------------------------------------------------
+  void Interfaces::PHG4ParticleIndex::Build(PHG4TruthInfoContainer* container, const int evt) {
+
+    Reset();
+    generation = GetEventGeneration();
+    event      = evt;
+    store      = container;
+    size       = container -> GetMap().size();
+    if (size == 0) return;
+
+    // track IDs are the map keys, so the range is
+    // given by the first and last entries
+    minID = container -> GetMap().begin() -> first;
+    const int maxID = container -> GetMap().rbegin() -> first;
+    byTrack.assign((size_t) ((int64_t) maxID - (int64_t) minID + 1), nullptr);
+    byBarcode.reserve(size);
+
+    PHG4TruthInfoContainer::ConstRange particles = container -> GetParticleRange();
+    for (
+      PHG4TruthInfoContainer::ConstIterator itPar = particles.first;
+      itPar != particles.second;
+      ++itPar
+    ) {
+      PHG4Particle* particle = itPar -> second;
+      if (!particle) continue;
+
+      byTrack[itPar -> first - minID] = particle;
+      byBarcode.emplace(particle -> get_barcode(), particle);
+    }  // end particle loop
+    return;
+
+  }  // end 'Build(PHG4TruthInfoContainer*, int)'
+
 
 }  // end SColdQcdCorrealtorAnalysis namespace
 
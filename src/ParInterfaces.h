@@ -14,7 +14,12 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
 // c++ utilities
+#include <limits>
+#include <vector>
 #include <cassert>
+#include <cstdint>
+#include <utility>
+#include <unordered_map>
 // phool libraries
 #include <phool/phool.h>
 #include <phool/getClass.h>
@@ -22,11 +27,15 @@
 #include <phool/PHNodeIterator.h>
 #include <phool/PHCompositeNode.h>
 // PHG4 libraries
+#include <g4main/PHG4Particle.h>
 #include <g4main/PHG4TruthInfoContainer.h>
 // hepmc libraries
 #include <HepMC/GenEvent.h>
+#include <HepMC/GenParticle.h>
 #include <phhepmc/PHHepMCGenEvent.h>
 #include <phhepmc/PHHepMCGenEventMap.h>
+// analysis utilities
+#include "NodeInterfaces.h"
 
 #pragma GCC diagnostic pop
 
@@ -38,13 +47,114 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Interfaces {
 
+    // ------------------------------------------------------------------------
+    //! Per-event index of HepMC particles by barcode
+    // ------------------------------------------------------------------------
+    /*! Maps barcodes onto the embedding ID of
+     *  the subevent a particle belongs to and
+     *  the particle itself. Filled in a single
+     *  sweep over all subevents, and refilled
+     *  whenever the event generation (see
+     *  GetEventGeneration()), the event sequence
+     *  number, or the event map changes. Outside
+     *  of any EventContext (generation 0), it's
+     *  never considered current. If a barcode
+     *  appears in several subevents, the first
+     *  one in map order is kept.
+     */
+    class HepMCBarcodeIndex {
+
+      private:
+
+        // data members
+        uint64_t                                           generation = 0;
+        int                                                event      = numeric_limits<int>::min();
+        size_t                                             size       = 0;
+        const void*                                        store      = nullptr;
+        unordered_map<int, pair<int, HepMC::GenParticle*>> table;
+
+      public:
+
+        // public methods
+        bool IsCurrent(const int evt, const void* str, const size_t nSub) const {
+          const uint64_t gen = GetEventGeneration();
+          return ((gen > 0) && (gen == generation) && (evt == event) && (str == store) && (nSub == size));
+        }
+        const pair<int, HepMC::GenParticle*>* Find(const int barcode) const {
+          auto itPar = table.find(barcode);
+          return (itPar != table.end()) ? &(itPar -> second) : nullptr;
+        }
+        void Reset();
+        void Build(PHHepMCGenEventMap* mcEvtMap, const int evt);
+
+    };  // end HepMCBarcodeIndex def
+
+
+
+    // ------------------------------------------------------------------------
+    //! Per-event index of PHG4Particles by track ID and barcode
+    // ------------------------------------------------------------------------
+    /*! Covers primaries and secondaries. Track
+     *  IDs index a dense vector offset by the
+     *  minimum track ID, while barcodes go
+     *  through a hash map. Refilled whenever the
+     *  event generation, the event sequence
+     *  number, or the container changes; as for
+     *  the HepMCBarcodeIndex, it's never current
+     *  outside of an EventContext.
+     */
+    class PHG4ParticleIndex {
+
+      private:
+
+        // data members
+        uint64_t                          generation = 0;
+        int                               event      = numeric_limits<int>::min();
+        size_t                            size       = 0;
+        const void*                       store      = nullptr;
+        int                               minID      = 0;
+        vector<PHG4Particle*>             byTrack;
+        unordered_map<int, PHG4Particle*> byBarcode;
+
+      public:
+
+        // public methods
+        bool IsCurrent(const int evt, const void* str, const size_t nPar) const {
+          const uint64_t gen = GetEventGeneration();
+          return ((gen > 0) && (gen == generation) && (evt == event) && (str == store) && (nPar == size));
+        }
+        PHG4Particle* FindByTrackID(const int id) const {
+          const int64_t iPar = (int64_t) id - (int64_t) minID;
+          return ((iPar >= 0) && (iPar < (int64_t) byTrack.size())) ? byTrack[iPar] : nullptr;
+        }
+        PHG4Particle* FindByBarcode(const int barcode) const {
+          auto itPar = byBarcode.find(barcode);
+          return (itPar != byBarcode.end()) ? itPar -> second : nullptr;
+        }
+        void Reset();
+        void Build(PHG4TruthInfoContainer* container, const int evt);
+
+    };  // end PHG4ParticleIndex def
+
+
+
     // particle interfaces ----------------------------------------------------
 
     PHG4TruthInfoContainer*            GetTruthContainer(PHCompositeNode* topNode);
     PHG4TruthInfoContainer::ConstRange GetPrimaries(PHCompositeNode* topNode);
     PHHepMCGenEventMap*                GetMcEventMap(PHCompositeNode* topNode);
     PHHepMCGenEvent*                   GetMcEvent(PHCompositeNode* topNode, const int iEvtToGrab);
+    PHHepMCGenEvent*                   GetMcEvent(PHHepMCGenEventMap* mcEvtMap, const int iEvtToGrab);
     HepMC::GenEvent*                   GetGenEvent(PHCompositeNode* topNode, const int iEvtToGrab);
+    HepMC::GenEvent*                   GetGenEvent(PHHepMCGenEventMap* mcEvtMap, const int iEvtToGrab);
+
+    // lookup tables
+    void                               ResetHepMCBarcodeIndex();
+    HepMCBarcodeIndex&                 GetHepMCBarcodeIndex();
+    const HepMCBarcodeIndex&           GetHepMCBarcodeIndex(PHHepMCGenEventMap* mcEvtMap, const int event);
+    void                               ResetPHG4ParticleIndex();
+    PHG4ParticleIndex&                 GetPHG4ParticleIndex();
+    const PHG4ParticleIndex&           GetPHG4ParticleIndex(PHG4TruthInfoContainer* container, const int event);
 
   }  // end Interfaces namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
@@ -38,11 +38,23 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   int Tools::GetEmbedID(PHCompositeNode* topNode, const int iEvtToGrab) {
 
+    Interfaces::EventContext context(topNode);
+    return GetEmbedID(context, iEvtToGrab);
+
+  }  // end 'GetEmbedID(PHCompositeNode*, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get Embedding ID from a subevent using an event context
+  // --------------------------------------------------------------------------
+  int Tools::GetEmbedID(Interfaces::EventContext& context, const int iEvtToGrab) {
+
     // grab mc event & return embedding id
-    PHHepMCGenEvent* mcEvt = Interfaces::GetMcEvent(topNode, iEvtToGrab);
+    PHHepMCGenEvent* mcEvt = context.GetMcEvent(iEvtToGrab);
     return mcEvt -> get_embedding_id();
 
-  }  // end 'GetEmbedID(PHCompositeNode*, int)'
+  }  // end 'GetEmbedID(EventContext&, int)'
 
 
 
@@ -51,12 +63,33 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   int Tools::GetEmbedIDFromBarcode(const int barcode, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetEmbedIDFromBarcode(barcode, context);
+
+  }  // end 'GetEmbedIDFromBarcode(int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get an embedding ID for a given barcode using an event context
+  // --------------------------------------------------------------------------
+  int Tools::GetEmbedIDFromBarcode(const int barcode, Interfaces::EventContext& context) {
+
+    // if event is identifiable, use barcode index
+    PHHepMCGenEventMap* mcEvtMap = context.GetMcEventMap();
+    const optional<int> sequence = context.GetEventSequence();
+    if (sequence.has_value()) {
+      return GetEmbedIDFromBarcode(
+        barcode,
+        Interfaces::GetHepMCBarcodeIndex(mcEvtMap, sequence.value())
+      );
+    }
+
     // by default, return signal
     int  idEmbed      = Const::SubEvt::NotEmbedSignal;
     bool foundBarcode = false;
 
-    // loop over all subevents to search
-    PHHepMCGenEventMap* mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    // otherwise loop over all subevents to search
     for (
       PHHepMCGenEventMap::ConstIter genEvt = mcEvtMap -> begin();
       genEvt != mcEvtMap -> end();
@@ -84,7 +117,20 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end subevent loop
     return idEmbed;
 
-  }  // end 'GetEmbedIDFromBarcode(int, PHCompositeNode*)'
+  }  // end 'GetEmbedIDFromBarcode(int, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get an embedding ID for a given barcode from a barcode index
+  // --------------------------------------------------------------------------
+  int Tools::GetEmbedIDFromBarcode(const int barcode, const Interfaces::HepMCBarcodeIndex& index) {
+
+    // by default, return signal
+    const pair<int, HepMC::GenParticle*>* entry = index.Find(barcode);
+    return entry ? entry -> first : (int) Const::SubEvt::NotEmbedSignal;
+
+  }  // end 'GetEmbedIDFromBarcode(int, Interfaces::HepMCBarcodeIndex&)'
 
 
 
@@ -93,13 +139,25 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   int Tools::GetEmbedIDFromTrackID(const int idTrack, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetEmbedIDFromTrackID(idTrack, context);
+
+  }  // end 'GetEmbedIDFromTrackID(int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get an embedding ID for a given track ID using an event context
+  // --------------------------------------------------------------------------
+  int Tools::GetEmbedIDFromTrackID(const int idTrack, Interfaces::EventContext& context) {
+
     // grab truth container
-    PHG4TruthInfoContainer* info = Interfaces::GetTruthContainer(topNode);
+    PHG4TruthInfoContainer* info = context.GetTruthContainer();
 
     // return embedding id
     return info -> isEmbeded(idTrack);
 
-  }  // end 'GetEmbedIDFromTrackID(int, PHCompositeNode*)'
+  }  // end 'GetEmbedIDFromTrackID(int, EventContext&)'
 
 
 
@@ -191,14 +249,7 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   float Tools::GetParticleCharge(const int pid) {
 
-    // particle charge
-    float charge = Const::MapPidOntoCharge()[abs(pid)];
-
-    // if antiparticle, flip charge and return
-    if (pid < 0) {
-      charge *= -1.;
-    }
-    return charge;
+    return Const::PidOntoCharge(pid);
 
   }  // end 'GetParticleCharge(int)'
 
@@ -212,10 +263,25 @@ namespace SColdQcdCorrelatorAnalysis {
     vector<int> subEvtsToUse
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GrabSubevents(context, subEvtsToUse);
+
+  }  // end 'GrabSubevents(PHCompositeNode*, vector<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get list of embedding IDs to use with an event context
+  // --------------------------------------------------------------------------
+  vector<int> Tools::GrabSubevents(
+    Interfaces::EventContext& context,
+    vector<int> subEvtsToUse
+  ) {
+
     // instantiate vector to hold subevents
     vector<int> subevents;
   
-    PHHepMCGenEventMap* mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    PHHepMCGenEventMap* mcEvtMap = context.GetMcEventMap();
     for (
       PHHepMCGenEventMap::ConstIter itEvt = mcEvtMap -> begin();
       itEvt != mcEvtMap -> end();
@@ -240,7 +306,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return subevents;
 
-  }  // end 'GrabSubevents(PHCompositeNode*, vector<int>)'
+  }  // end 'GrabSubevents(EventContext&, vector<int>)'
 
 
 
@@ -253,10 +319,26 @@ namespace SColdQcdCorrelatorAnalysis {
     const bool isEmbed
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GrabSubevents(context, option, isEmbed);
+
+  }  // end 'GrabSubevents(PHCompositeNode*, optional<vector<int>>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get subevents based on a specified option using an event context
+  // --------------------------------------------------------------------------
+  vector<int> Tools::GrabSubevents(
+    Interfaces::EventContext& context,
+    const int option,
+    const bool isEmbed
+  ) {
+
     // instantiate vector to hold subevents
     vector<int> subevents;
   
-    PHHepMCGenEventMap* mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    PHHepMCGenEventMap* mcEvtMap = context.GetMcEventMap();
     for (
       PHHepMCGenEventMap::ConstIter itEvt = mcEvtMap -> begin();
       itEvt != mcEvtMap -> end();
@@ -272,7 +354,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return subevents;
 
-  }  // end 'GrabSubevents(PHCompositeNode*, optional<vector<int>>)'
+  }  // end 'GrabSubevents(EventContext&, optional<vector<int>>)'
 
 
 
@@ -284,13 +366,35 @@ namespace SColdQcdCorrelatorAnalysis {
     PHCompositeNode* topNode
   ) {
 
-    // by default, return null pointer
-    PHG4Particle* parToGrab = NULL;
+    Interfaces::EventContext context(topNode);
+    return GetPHG4ParticleFromBarcode(barcode, context);
+
+  }  // end 'GetPHG4ParticleFromBarcode(int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a PHG4Particle based on its barcode using an event context
+  // --------------------------------------------------------------------------
+  PHG4Particle* Tools::GetPHG4ParticleFromBarcode(
+    const int barcode,
+    Interfaces::EventContext& context
+  ) {
 
     // grab truth info container
-    PHG4TruthInfoContainer* container = Interfaces::GetTruthContainer(topNode);
+    PHG4TruthInfoContainer* container = context.GetTruthContainer();
+
+    // if event is identifiable, use particle index
+    const optional<int> sequence = context.GetEventSequence();
+    if (sequence.has_value()) {
+      return GetPHG4ParticleFromBarcode(
+        barcode,
+        Interfaces::GetPHG4ParticleIndex(container, sequence.value())
+      );
+    }
 
-    // loop over all particles in container to search
+    // otherwise loop over all particles in container to search
+    PHG4Particle* parToGrab = NULL;
     PHG4TruthInfoContainer::ConstRange particles = container -> GetParticleRange();
     for (
       PHG4TruthInfoContainer::ConstIterator itPar = particles.first;
@@ -304,7 +408,18 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end particle loop
     return parToGrab;
 
-  }  // end 'GetPHG4ParticleFromBarcode(int, PHCompositeNode*)'
+  }  // end 'GetPHG4ParticleFromBarcode(int, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a PHG4Particle based on its barcode from a particle index
+  // --------------------------------------------------------------------------
+  PHG4Particle* Tools::GetPHG4ParticleFromBarcode(const int barcode, const Interfaces::PHG4ParticleIndex& index) {
+
+    return index.FindByBarcode(barcode);
+
+  }  // end 'GetPHG4ParticleFromBarcode(int, Interfaces::PHG4ParticleIndex&)'
 
 
 
@@ -313,13 +428,32 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   PHG4Particle* Tools::GetPHG4ParticleFromTrackID(const int id, PHCompositeNode* topNode) {
 
-    // by default, return null pointer
-    PHG4Particle* parToGrab = NULL;
+    Interfaces::EventContext context(topNode);
+    return GetPHG4ParticleFromTrackID(id, context);
+
+  }  // end 'GetPHG4ParticleFromTrackID(int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a PHG4Particle based on its "track code" using an event context
+  // --------------------------------------------------------------------------
+  PHG4Particle* Tools::GetPHG4ParticleFromTrackID(const int id, Interfaces::EventContext& context) {
 
     // grab truth info container
-    PHG4TruthInfoContainer* container = Interfaces::GetTruthContainer(topNode);
+    PHG4TruthInfoContainer* container = context.GetTruthContainer();
+
+    // if event is identifiable, use particle index
+    const optional<int> sequence = context.GetEventSequence();
+    if (sequence.has_value()) {
+      return GetPHG4ParticleFromTrackID(
+        id,
+        Interfaces::GetPHG4ParticleIndex(container, sequence.value())
+      );
+    }
 
-    // loop over all particles in container to search
+    // otherwise loop over all particles in container to search
+    PHG4Particle* parToGrab = NULL;
     PHG4TruthInfoContainer::ConstRange particles = container -> GetParticleRange();
     for (
       PHG4TruthInfoContainer::ConstIterator itPar = particles.first;
@@ -333,7 +467,18 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end particle loop
     return parToGrab;
 
-  }  // end 'GetPHG4ParticleFromTrackID(int, PHCompositeNode*)'
+  }  // end 'GetPHG4ParticleFromTrackID(int, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a PHG4Particle based on its "track code" from a particle index
+  // --------------------------------------------------------------------------
+  PHG4Particle* Tools::GetPHG4ParticleFromTrackID(const int id, const Interfaces::PHG4ParticleIndex& index) {
+
+    return index.FindByTrackID(id);
+
+  }  // end 'GetPHG4ParticleFromTrackID(int, Interfaces::PHG4ParticleIndex&)'
 
 
 
@@ -345,12 +490,36 @@ namespace SColdQcdCorrelatorAnalysis {
     PHCompositeNode* topNode
   ) {
 
+    Interfaces::EventContext context(topNode);
+    return GetHepMCGenParticleFromBarcode(barcode, context);
+
+  }  // end 'GetHepMCGenParticleFromBarcode(int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a HepMC GenParticle based on its barcode using an event context
+  // --------------------------------------------------------------------------
+  HepMC::GenParticle* Tools::GetHepMCGenParticleFromBarcode(
+    const int barcode,
+    Interfaces::EventContext& context
+  ) {
+
+    // if event is identifiable, use barcode index
+    PHHepMCGenEventMap* mcEvtMap = context.GetMcEventMap();
+    const optional<int> sequence = context.GetEventSequence();
+    if (sequence.has_value()) {
+      return GetHepMCGenParticleFromBarcode(
+        barcode,
+        Interfaces::GetHepMCBarcodeIndex(mcEvtMap, sequence.value())
+      );
+    }
+
     // by default, return null pointer
     HepMC::GenParticle* parToGrab    = NULL;
     bool                foundBarcode = false;
 
-    // loop over all subevents to search
-    PHHepMCGenEventMap* mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    // otherwise loop over all subevents to search
     for (
       PHHepMCGenEventMap::ConstIter genEvt = mcEvtMap -> begin();
       genEvt != mcEvtMap -> end();
@@ -378,7 +547,23 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end subevent loop
     return parToGrab;
 
-  }  // end 'GetHepMCGenParticleFromBarcode(int, PHCompositeNode*)'
+  }  // end 'GetHepMCGenParticleFromBarcode(int, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Find a HepMC GenParticle based on its barcode from a barcode index
+  // --------------------------------------------------------------------------
+  HepMC::GenParticle* Tools::GetHepMCGenParticleFromBarcode(
+    const int barcode,
+    const Interfaces::HepMCBarcodeIndex& index
+  ) {
+
+    // by default, return null pointer
+    const pair<int, HepMC::GenParticle*>* entry = index.Find(barcode);
+    return entry ? entry -> second : NULL;
+
+  }  // end 'GetHepMCGenParticleFromBarcode(int, Interfaces::HepMCBarcodeIndex&)'
 
 }  // end SColdQcdCorrealtorAnalysis namespace
 
@@ -51,17 +51,29 @@ namespace SColdQcdCorrelatorAnalysis {
 
     int                 GetSignal(const bool isEmbed);
     int                 GetEmbedID(PHCompositeNode* topNode, const int iEvtToGrab);
+    int                 GetEmbedID(Interfaces::EventContext& context, const int iEvtToGrab);
     int                 GetEmbedIDFromBarcode(const int barcode, PHCompositeNode* topNode);
+    int                 GetEmbedIDFromBarcode(const int barcode, Interfaces::EventContext& context);
+    int                 GetEmbedIDFromBarcode(const int barcode, const Interfaces::HepMCBarcodeIndex& index);
     int                 GetEmbedIDFromTrackID(const int idTrack, PHCompositeNode* topNode);
+    int                 GetEmbedIDFromTrackID(const int idTrack, Interfaces::EventContext& context);
     bool                IsFinalState(const int status);
     bool                IsSubEvtGood(const int embedID, const int option, const bool isEmbed);
     bool                IsSubEvtGood(const int embedID, vector<int> subEvtsToUse);
     float               GetParticleCharge(const int pid);
     vector<int>         GrabSubevents(PHCompositeNode* topNode, vector<int> subEvtsToUse);
+    vector<int>         GrabSubevents(Interfaces::EventContext& context, vector<int> subEvtsToUse);
     vector<int>         GrabSubevents(PHCompositeNode* topNode, const int option = Const::SubEvtOpt::Everything, const bool isEmbed = false);
+    vector<int>         GrabSubevents(Interfaces::EventContext& context, const int option = Const::SubEvtOpt::Everything, const bool isEmbed = false);
     PHG4Particle*       GetPHG4ParticleFromBarcode(const int barcode, PHCompositeNode* topNode);
+    PHG4Particle*       GetPHG4ParticleFromBarcode(const int barcode, Interfaces::EventContext& context);
+    PHG4Particle*       GetPHG4ParticleFromBarcode(const int barcode, const Interfaces::PHG4ParticleIndex& index);
     PHG4Particle*       GetPHG4ParticleFromTrackID(const int id, PHCompositeNode* topNode);
+    PHG4Particle*       GetPHG4ParticleFromTrackID(const int id, Interfaces::EventContext& context);
+    PHG4Particle*       GetPHG4ParticleFromTrackID(const int id, const Interfaces::PHG4ParticleIndex& index);
     HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode, PHCompositeNode* topNode);
+    HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode, Interfaces::EventContext& context);
+    HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode, const Interfaces::HepMCBarcodeIndex& index);
 
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
@@ -27,6 +27,7 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::REvtInfo::Minimize() {
 
+    pending   = 0;
     nTrks     = -1 * numeric_limits<int>::max();
     pSumTrks  = -1. * numeric_limits<double>::max();
     eSumEMCal = -1. * numeric_limits<double>::max();
@@ -47,6 +48,7 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::REvtInfo::Maximize() {
 
+    pending   = 0;
     nTrks     = numeric_limits<int>::max();
     pSumTrks  = numeric_limits<double>::max();
     eSumEMCal = numeric_limits<double>::max();
@@ -62,6 +64,75 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Compute any pending groups of members
+  // --------------------------------------------------------------------------
+  /*! If everything is pending, the fused event
+   *  summary is used. Otherwise only the
+   *  requested containers are visited.
+   */
+  void Types::REvtInfo::Fetch(const uint8_t parts) const {
+
+    const uint8_t toFetch = pending & parts;
+    if (toFetch == 0) return;
+
+    Interfaces::EventContext context(lazyNode);
+    if (toFetch == Lazy::All) {
+      SetSummary( Tools::GetREvtSummary(context) );
+    } else {
+
+      // get vertex
+      if (toFetch & Lazy::Vertex) {
+        ROOT::Math::XYZVector vtx = context.GetRecoVtx();
+        vx = vtx.x();
+        vy = vtx.y();
+        vz = vtx.z();
+        vr = hypot(vx, vy);
+      }
+
+      // get track sums
+      if (toFetch & Lazy::Tracks) {
+        nTrks    = Tools::GetNumTrks(context);
+        pSumTrks = Tools::GetSumTrkMomentum(context);
+      }
+
+      // get calo sums
+      if (toFetch & Lazy::Calo) {
+        eSumEMCal = Tools::GetSumCaloEne(context, string(Const::IndexOntoClusters(Const::Subsys::EMCal)));
+        eSumIHCal = Tools::GetSumCaloEne(context, string(Const::IndexOntoClusters(Const::Subsys::IHCal)));
+        eSumOHCal = Tools::GetSumCaloEne(context, string(Const::IndexOntoClusters(Const::Subsys::OHCal)));
+      }
+    }
+    pending &= ~toFetch;
+    return;
+
+  }  // end 'Fetch(uint8_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Set members from an event summary
+  // --------------------------------------------------------------------------
+  void Types::REvtInfo::SetSummary(const Tools::REvtSummary& summary) const {
+
+    // get sums
+    nTrks     = summary.nTrks;
+    pSumTrks  = summary.pSumTrks;
+    eSumEMCal = summary.eSumCalo[Const::Subsys::EMCal];
+    eSumIHCal = summary.eSumCalo[Const::Subsys::IHCal];
+    eSumOHCal = summary.eSumCalo[Const::Subsys::OHCal];
+
+    // get vertex
+    vx = summary.vtx.x();
+    vy = summary.vtx.y();
+    vz = summary.vtx.z();
+    vr = hypot(vx, vy);
+    return;
+
+  }  // end 'SetSummary(Tools::REvtSummary&)'
+
+
+
   // public methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -69,6 +140,8 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::REvtInfo::Reset() {
 
+    lazyNode = nullptr;
+    pending  = 0;
     Maximize();
     return;
 
@@ -81,25 +154,64 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::REvtInfo::SetInfo(PHCompositeNode* topNode) {
 
-    // get sums
-    nTrks     = Tools::GetNumTrks(topNode);
-    pSumTrks  = Tools::GetSumTrkMomentum(topNode);
-    eSumEMCal = Tools::GetSumCaloEne(topNode, "CLUSTER_CEMC");
-    eSumIHCal = Tools::GetSumCaloEne(topNode, "CLUSTER_HCALIN");
-    eSumOHCal = Tools::GetSumCaloEne(topNode, "CLUSTER_HCALOUT");
-
-    // get vertex
-    ROOT::Math::XYZVector vtx = Interfaces::GetRecoVtx(topNode);
-    vx = vtx.x();
-    vy = vtx.y();
-    vz = vtx.z();
-    vr = hypot(vx, vy);
+    Interfaces::EventContext context(topNode);
+    SetInfo(context);
     return;
 
   }  // end 'SetInfo(PHCompositeNode*)'
 
 
 
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A node using an event context
+  // --------------------------------------------------------------------------
+  void Types::REvtInfo::SetInfo(Interfaces::EventContext& context) {
+
+    // summarize event in one pass
+    lazyNode = nullptr;
+    pending  = 0;
+    SetSummary( Tools::GetREvtSummary(context) );
+    return;
+
+  }  // end 'SetInfo(EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Point object to a F4A node without computing anything yet
+  // --------------------------------------------------------------------------
+  /*! Each group of members is then computed
+   *  the first time one of its getters is
+   *  called. The node must stay valid until
+   *  then, i.e. within the current event.
+   */
+  void Types::REvtInfo::SetInfoLazy(PHCompositeNode* topNode) {
+
+    Reset();
+    lazyNode = topNode;
+    pending  = Lazy::All;
+    return;
+
+  }  // end 'SetInfoLazy(PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Compute all pending members
+  // --------------------------------------------------------------------------
+  /*! Call before writing a lazily set object
+   *  out, since ROOT I/O reads the members
+   *  directly.
+   */
+  void Types::REvtInfo::Materialize() {
+
+    Fetch(Lazy::All);
+    return;
+
+  }  // end 'Materialize()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -124,6 +236,40 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // overloaded operators =====================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy assignment
+  // --------------------------------------------------------------------------
+  /*! Pending members of the source are fetched
+   *  first, while its node is still valid, so
+   *  the copy never refers to that node.
+   */
+  Types::REvtInfo& Types::REvtInfo::operator =(const REvtInfo& other) {
+
+    if (this == &other) return *this;
+    other.Fetch(Lazy::All);
+
+    // copy members
+    nTrks     = other.nTrks;
+    pSumTrks  = other.pSumTrks;
+    eSumEMCal = other.eSumEMCal;
+    eSumIHCal = other.eSumIHCal;
+    eSumOHCal = other.eSumOHCal;
+    vx        = other.vx;
+    vy        = other.vy;
+    vz        = other.vz;
+    vr        = other.vr;
+
+    // and clear lazy state
+    lazyNode = nullptr;
+    pending  = 0;
+    return *this;
+
+  }  // end 'operator =(REvtInfo&)'
+
+
+
   // ctor/dtor ================================================================
 
   // --------------------------------------------------------------------------
@@ -148,6 +294,17 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Copy constructor
+  // --------------------------------------------------------------------------
+  Types::REvtInfo::REvtInfo(const REvtInfo& other) {
+
+    *this = other;
+
+  }  // end ctor(REvtInfo&)
+
+
+
   // --------------------------------------------------------------------------
   //! Constructor accepting initialization option (minimize or maximize)
   // --------------------------------------------------------------------------
@@ -178,6 +335,32 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(PHCompositeNode*)
 
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting an event context
+  // --------------------------------------------------------------------------
+  Types::REvtInfo::REvtInfo(Interfaces::EventContext& context) {
+
+    SetInfo(context);
+
+  }  // end ctor(EventContext&)
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A node and a lazy evaluation flag
+  // --------------------------------------------------------------------------
+  Types::REvtInfo::REvtInfo(PHCompositeNode* topNode, const bool lazy) {
+
+    if (lazy) {
+      SetInfoLazy(topNode);
+    } else {
+      SetInfo(topNode);
+    }
+
+  }  // end ctor(PHCompositeNode*, bool)
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include <limits>
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <optional>
 // root libraries
 #include <Rtypes.h>
@@ -41,64 +42,89 @@ namespace SColdQcdCorrelatorAnalysis {
     /*! A class to consolidate event-level
      *  reconstructed information. Can be
      *  by pointing class to a F4A node.
+     *  Copies are never lazy: anything
+     *  pending is fetched from the source
+     *  first.
      */ 
     class REvtInfo {
 
       private:
 
-        // data members
-        int    nTrks     = numeric_limits<int>::max();
-        double pSumTrks  = numeric_limits<double>::max();
-        double eSumEMCal = numeric_limits<double>::max();
-        double eSumIHCal = numeric_limits<double>::max();
-        double eSumOHCal = numeric_limits<double>::max();
-        double vx        = numeric_limits<double>::max();
-        double vy        = numeric_limits<double>::max();
-        double vz        = numeric_limits<double>::max();
-        double vr        = numeric_limits<double>::max();
+        // data members (mutable so lazy getters can fill them)
+        mutable int    nTrks     = numeric_limits<int>::max();
+        mutable double pSumTrks  = numeric_limits<double>::max();
+        mutable double eSumEMCal = numeric_limits<double>::max();
+        mutable double eSumIHCal = numeric_limits<double>::max();
+        mutable double eSumOHCal = numeric_limits<double>::max();
+        mutable double vx        = numeric_limits<double>::max();
+        mutable double vy        = numeric_limits<double>::max();
+        mutable double vz        = numeric_limits<double>::max();
+        mutable double vr        = numeric_limits<double>::max();
+
+        // lazy evaluation state (not persistified)
+        PHCompositeNode* lazyNode = nullptr;  //!
+        mutable uint8_t  pending  = 0;        //!
+
+        //! Groups of members which can be computed lazily
+        enum Lazy : uint8_t {Vertex = 1, Tracks = 2, Calo = 4, All = 7};
 
         // private methods
         void Minimize();
         void Maximize();
+        void Fetch(const uint8_t parts) const;
+        void SetSummary(const Tools::REvtSummary& summary) const;
 
       public:
 
         // getters
-        int    GetNTrks()     const {return nTrks;}
-        double GetPSumTrks()  const {return pSumTrks;}
-        double GetESumEMCal() const {return eSumEMCal;}
-        double GetESumIHCal() const {return eSumIHCal;}
-        double GetESumOHCal() const {return eSumOHCal;}
-        double GetVX()        const {return vx;}
-        double GetVY()        const {return vy;}
-        double GetVZ()        const {return vz;}
-        double GetVR()        const {return vr;}
-
-        // setters
-        void SetNTrks(const int arg_nTrks)            {nTrks     = arg_nTrks;}
-        void SetPSumTrks(const double arg_pSumTrks)   {pSumTrks  = arg_pSumTrks;}
-        void SetESumEMCal(const double arg_eSumEMCal) {eSumEMCal = arg_eSumEMCal;}
-        void SetESumIHCal(const double arg_eSumIHCal) {eSumIHCal = arg_eSumIHCal;}
-        void SetESumOHCal(const double arg_eSumOHCal) {eSumOHCal = arg_eSumOHCal;}
-        void SetVX(const double arg_vx)               {vx        = arg_vx;}
-        void SetVY(const double arg_vy)               {vy        = arg_vy;}
-        void SetVZ(const double arg_vz)               {vz        = arg_vz;}
-        void SetVR(const double arg_vr)               {vr        = arg_vr;}
+        int    GetNTrks()     const {Fetch(Lazy::Tracks); return nTrks;}
+        double GetPSumTrks()  const {Fetch(Lazy::Tracks); return pSumTrks;}
+        double GetESumEMCal() const {Fetch(Lazy::Calo);   return eSumEMCal;}
+        double GetESumIHCal() const {Fetch(Lazy::Calo);   return eSumIHCal;}
+        double GetESumOHCal() const {Fetch(Lazy::Calo);   return eSumOHCal;}
+        double GetVX()        const {Fetch(Lazy::Vertex); return vx;}
+        double GetVY()        const {Fetch(Lazy::Vertex); return vy;}
+        double GetVZ()        const {Fetch(Lazy::Vertex); return vz;}
+        double GetVR()        const {Fetch(Lazy::Vertex); return vr;}
+        bool   IsLazy()       const {return (pending != 0);}
+
+        // setters (resolve the member's group first, so a
+        // pending fetch can't overwrite the set value)
+        void SetNTrks(const int arg_nTrks)            {Fetch(Lazy::Tracks); nTrks     = arg_nTrks;}
+        void SetPSumTrks(const double arg_pSumTrks)   {Fetch(Lazy::Tracks); pSumTrks  = arg_pSumTrks;}
+        void SetESumEMCal(const double arg_eSumEMCal) {Fetch(Lazy::Calo);   eSumEMCal = arg_eSumEMCal;}
+        void SetESumIHCal(const double arg_eSumIHCal) {Fetch(Lazy::Calo);   eSumIHCal = arg_eSumIHCal;}
+        void SetESumOHCal(const double arg_eSumOHCal) {Fetch(Lazy::Calo);   eSumOHCal = arg_eSumOHCal;}
+        void SetVX(const double arg_vx)               {Fetch(Lazy::Vertex); vx        = arg_vx;}
+        void SetVY(const double arg_vy)               {Fetch(Lazy::Vertex); vy        = arg_vy;}
+        void SetVZ(const double arg_vz)               {Fetch(Lazy::Vertex); vz        = arg_vz;}
+        void SetVR(const double arg_vr)               {Fetch(Lazy::Vertex); vr        = arg_vr;}
 
         // public methods
         void Reset();
         void SetInfo(PHCompositeNode* topNode);
+        void SetInfo(Interfaces::EventContext& context);
+        void SetInfoLazy(PHCompositeNode* topNode);
+        void Materialize();
 
         // static methods
         static vector<string> GetListOfMembers();
 
+        // overloaded operators
+        REvtInfo& operator =(const REvtInfo& other);
+
         // default ctor/dtor
         REvtInfo();
         ~REvtInfo();
 
+        // copy ctor
+        REvtInfo(const REvtInfo& other);
+
         // ctors accepting arguments
         REvtInfo(Const::Init init);
         REvtInfo(PHCompositeNode* topNode);
+        REvtInfo(Interfaces::EventContext& context);
+        REvtInfo(PHCompositeNode* topNode, const bool lazy);
 
       // identify this class to ROOT
       ClassDefNV(REvtInfo, 1)
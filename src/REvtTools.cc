@@ -27,11 +27,23 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   int64_t Tools::GetNumTrks(PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetNumTrks(context);
+
+  }  // end 'GetNumTrks(PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get total number of tracks using an event context
+  // --------------------------------------------------------------------------
+  int64_t Tools::GetNumTrks(Interfaces::EventContext& context) {
+
     // grab size of track map
-    SvtxTrackMap* mapTrks = Interfaces::GetTrackMap(topNode);
+    SvtxTrackMap* mapTrks = context.GetTrackMap();
     return mapTrks -> size();
 
-  }  // end 'GetNumTrks(PHCompositeNode*)'
+  }  // end 'GetNumTrks(EventContext&)'
 
 
 
@@ -40,8 +52,20 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   double Tools::GetSumTrkMomentum(PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetSumTrkMomentum(context);
+
+  }  // end 'GetSumTrkMomentum(PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get sum of track momentum using an event context
+  // --------------------------------------------------------------------------
+  double Tools::GetSumTrkMomentum(Interfaces::EventContext& context) {
+
     // grab track map
-    SvtxTrackMap* mapTrks = Interfaces::GetTrackMap(topNode);
+    SvtxTrackMap* mapTrks = context.GetTrackMap();
 
     // loop over tracks
     double pSum = 0.;
@@ -61,7 +85,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return pSum;
 
-  }  // end 'GetSumTrkMomentum(PHCompositeNode*)'
+  }  // end 'GetSumTrkMomentum(EventContext&)'
 
 
 
@@ -70,8 +94,20 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   double Tools::GetSumCaloEne(PHCompositeNode* topNode, const string store) {
 
+    Interfaces::EventContext context(topNode);
+    return GetSumCaloEne(context, store);
+
+  }  // end 'GetSumCaloEne(PHCompositeNode*, string)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get sum of energy from a calorimeter using an event context
+  // --------------------------------------------------------------------------
+  double Tools::GetSumCaloEne(Interfaces::EventContext& context, const string store) {
+
     // grab clusters
-    RawClusterContainer::ConstRange clusters = Interfaces::GetClusters(topNode, store);
+    RawClusterContainer::ConstRange clusters = context.GetClusters(store);
 
     // loop over clusters
     double eSum = 0.;
@@ -91,7 +127,123 @@ namespace SColdQcdCorrelatorAnalysis {
     }  // end cluster loop
     return eSum;
 
-  }  // end 'GetSumCaloEne(PHCompositeNode*, string)'
+  }  // end 'GetSumCaloEne(EventContext&, string)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Summarize reconstructed objects of an event
+  // --------------------------------------------------------------------------
+  Tools::REvtSummary Tools::GetREvtSummary(PHCompositeNode* topNode, const REvtSummaryOptions& options) {
+
+    Interfaces::EventContext context(topNode);
+    return GetREvtSummary(context, options);
+
+  }  // end 'GetREvtSummary(PHCompositeNode*, REvtSummaryOptions&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Summarize reconstructed objects of an event using an event context
+  // --------------------------------------------------------------------------
+  /*! Visits the track map and each calorimeter
+   *  container once. Calorimeter energy can be
+   *  summed from either clusters or towers,
+   *  and transverse energies are calculated
+   *  wrt. the reconstructed vertex.
+   */
+  Tools::REvtSummary Tools::GetREvtSummary(Interfaces::EventContext& context, const REvtSummaryOptions& options) {
+
+    REvtSummary summary;
+
+    // grab vertex first, needed for transverse energies
+    summary.vtx = context.GetRecoVtx();
+
+    // sum over tracks
+    SvtxTrackMap* mapTrks = context.GetTrackMap();
+    summary.nTrks = mapTrks -> size();
+    for (
+      SvtxTrackMap::Iter itTrk = mapTrks -> begin();
+      itTrk != mapTrks -> end();
+      ++itTrk
+    ) {
+
+      // grab track
+      const SvtxTrack* track = itTrk -> second;
+      if (!track) continue;
+
+      summary.pSumTrks  += std::hypot(track -> get_px(), track -> get_py(), track -> get_pz());
+      summary.ptSumTrks += std::hypot(track -> get_px(), track -> get_py());
+      if (options.trkVisitor) options.trkVisitor(track);
+    }  // end track loop
+
+    // sum over calorimeters
+    for (const int sys : {Const::Subsys::EMCal, Const::Subsys::IHCal, Const::Subsys::OHCal}) {
+      switch (options.source) {
+
+        // sum over clusters
+        case Const::CaloSource::Clusters:
+          {
+            RawClusterContainer::ConstRange clusters = context.GetClusters( Const::IndexOntoClusters(sys) );
+            for (
+              RawClusterContainer::ConstIterator itClust = clusters.first;
+              itClust != clusters.second;
+              ++itClust
+            ) {
+
+              // grab cluster
+              const RawCluster* cluster = itClust -> second;
+              if (!cluster) continue;
+
+              // get position wrt vertex
+              const ROOT::Math::XYZVector pos(
+                cluster -> get_position().x() - summary.vtx.x(),
+                cluster -> get_position().y() - summary.vtx.y(),
+                cluster -> get_position().z() - summary.vtx.z()
+              );
+
+              const double ene = cluster -> get_energy();
+              summary.eSumCalo[sys]  += ene;
+              summary.etSumCalo[sys] += (pos.R() > 0.) ? ene * (pos.Rho() / pos.R()) : 0.;
+              if (options.clustVisitor) options.clustVisitor(sys, cluster);
+            }  // end cluster loop
+          }
+          break;
+
+        // sum over towers
+        case Const::CaloSource::Towers:
+          {
+            TowerInfoContainer*            towers = context.GetTowerInfoStore( Const::IndexOntoTowerInfo(sys) );
+            const Interfaces::TwrGeoTable& table  = Interfaces::GetTwrGeoTable(sys, context, true, true);
+            for (size_t iChan = 0; iChan < towers -> size(); ++iChan) {
+
+              // grab tower
+              TowerInfo* tower = towers -> get_tower_at_channel(iChan);
+              if (!tower) continue;
+
+              // get position wrt vertex, skipping towers
+              // without a geometry (see TwrGeoTable)
+              const double rho = table.radius[iChan];
+              const double dz  = table.z[iChan] - summary.vtx.z();
+              if (std::isnan(rho) || std::isnan(dz)) continue;
+              const double r   = std::hypot(rho, dz);
+
+              const double ene    = tower -> get_energy();
+              const int    status = GetTowerStatus(tower);
+              summary.eSumCalo[sys]  += ene;
+              summary.etSumCalo[sys] += (r > 0.) ? ene * (rho / r) : 0.;
+              ++summary.nTwrByStatus[sys][status];
+              if (options.twrVisitor) options.twrVisitor(sys, iChan, tower, status);
+            }  // end tower loop
+          }
+          break;
+
+      }  // end switch (options.source)
+    }  // end subsystem loop
+    return summary;
+
+  }  // end 'GetREvtSummary(EventContext&, REvtSummaryOptions&)'
+
 
 }  // end SColdQcdCorrelatorAnalysis namespace
 
@@ -12,10 +12,12 @@
 #define SCORRELATORUTILITIES_REVTTOOLS_H
 
 // c++ utilities
+#include <array>
 #include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
+#include <functional>
 // root libraries
 #include <Math/Vector3D.h>
 // phool libraries
@@ -24,10 +26,13 @@
 #include <calobase/RawCluster.h>
 #include <calobase/RawClusterUtility.h>
 #include <calobase/RawClusterContainer.h>
+#include <calobase/TowerInfo.h>
+#include <calobase/TowerInfoContainer.h>
 // tracking includes
 #include <trackbase_historic/SvtxTrack.h>
 #include <trackbase_historic/SvtxTrackMap.h>
 // analysis utilities
+#include "TwrTools.h"
 #include "Constants.h"
 #include "Interfaces.h"
 
@@ -39,11 +44,58 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // ------------------------------------------------------------------------
+    //! Options for GetREvtSummary
+    // ------------------------------------------------------------------------
+    /*! Visitors are called on every object
+     *  of the corresponding type as it is
+     *  summed, so further quantities can be
+     *  accumulated in the same pass. Cluster
+     *  visitors receive (subsystem, cluster),
+     *  and tower visitors receive (subsystem,
+     *  channel, tower, status).
+     */
+    struct REvtSummaryOptions {
+      Const::CaloSource                                           source = Const::CaloSource::Clusters;
+      function<void(const SvtxTrack*)>                            trkVisitor;
+      function<void(const int, const RawCluster*)>                clustVisitor;
+      function<void(const int, const int, TowerInfo*, const int)> twrVisitor;
+    };
+
+    // ------------------------------------------------------------------------
+    //! Summary of reconstructed objects in an event
+    // ------------------------------------------------------------------------
+    /*! Calorimeter sums are indexed by subsystem
+     *  (Const::Subsys). Tower counts per status
+     *  (Const::TowerStatus) are only filled when
+     *  towers are used as the calorimeter source.
+     */
+    struct REvtSummary {
+      typedef array<double, Const::Subsys::OHCal + 1>       CaloSums;
+      typedef array<int64_t, Const::TowerStatus::NA + 1>    StatusCounts;
+      typedef array<StatusCounts, Const::Subsys::OHCal + 1> CaloStatusCounts;
+
+      int64_t               nTrks        = 0;
+      double                pSumTrks     = 0.;
+      double                ptSumTrks    = 0.;
+      CaloSums              eSumCalo     = {};
+      CaloSums              etSumCalo    = {};
+      CaloStatusCounts      nTwrByStatus = {};
+      ROOT::Math::XYZVector vtx;
+    };
+
     // event-level reconstructed tools ----------------------------------------
 
     int64_t GetNumTrks(PHCompositeNode* topNode);
+    int64_t GetNumTrks(Interfaces::EventContext& context);
     double  GetSumTrkMomentum(PHCompositeNode* topNode);
+    double  GetSumTrkMomentum(Interfaces::EventContext& context);
     double  GetSumCaloEne(PHCompositeNode* topNode, const string store);
+    double  GetSumCaloEne(Interfaces::EventContext& context, const string store);
+
+    // event-level summaries
+    REvtSummary GetREvtSummary(PHCompositeNode* topNode, const REvtSummaryOptions& options = {});
+    REvtSummary GetREvtSummary(Interfaces::EventContext& context, const REvtSummaryOptions& options = {});
 
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
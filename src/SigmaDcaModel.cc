@@ -0,0 +1,105 @@
+/// ---------------------------------------------------------------------------
+/*! \file   SigmaDcaModel.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Compiled parameterization of the track DCA width
+ *  vs. pt.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_SIGMADCAMODEL_CC
+
+// class definition
+#include "SigmaDcaModel.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Evaluate model for an array of values
+  // --------------------------------------------------------------------------
+  /*! Values above xMax are evaluated at xMax,
+   *  mirroring how the fits are extrapolated
+   *  past their maximum pt.
+   */
+  void Types::SigmaDcaModel::EvalBatch(
+    const double* xs,
+    double* sigmas,
+    const size_t nVal,
+    const double xMax
+  ) const {
+
+    // copy parameters to locals so the loop vectorizes
+    const double p0 = params[0];
+    const double p1 = params[1];
+    const double p2 = params[2];
+    for (size_t iVal = 0; iVal < nVal; ++iVal) {
+      const double x = min(xs[iVal], xMax);
+      sigmas[iVal] = p0 + (p1 / x) + (p2 / (x * x));
+    }
+    return;
+
+  }  // end 'EvalBatch(double*, double*, size_t, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Evaluate model for a vector of values
+  // --------------------------------------------------------------------------
+  void Types::SigmaDcaModel::EvalBatch(
+    const vector<double>& xs,
+    vector<double>& sigmas,
+    const double xMax
+  ) const {
+
+    sigmas.resize(xs.size());
+    EvalBatch(xs.data(), sigmas.data(), xs.size(), xMax);
+    return;
+
+  }  // end 'EvalBatch(vector<double>&, vector<double>&, double)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Evaluate model for a vector of values, clamped to the fit range
+  // --------------------------------------------------------------------------
+  void Types::SigmaDcaModel::EvalBatch(const vector<double>& xs, vector<double>& sigmas) const {
+
+    EvalBatch(xs, sigmas, range.second);
+    return;
+
+  }  // end 'EvalBatch(vector<double>&, vector<double>&)'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting parameters and fit range
+  // --------------------------------------------------------------------------
+  Types::SigmaDcaModel::SigmaDcaModel(const vector<float> pars, const pair<float, float> fitRange) {
+
+    if (pars.size() < params.size()) {
+      cerr << PHWHERE
+           << "PANIC: sigma dca model needs " << params.size() << " parameters, but " << pars.size() << " were provided!"
+           << endl;
+      assert(pars.size() >= params.size());
+    }
+    // missing parameters (only reachable with asserts disabled) are left at 0
+    const size_t nPars = min(pars.size(), params.size());
+    params.fill(0.);
+    copy(pars.begin(), pars.begin() + nPars, params.begin());
+    range = fitRange;
+
+  }  // end ctor(vector<float>, pair<float, float>)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,83 @@
+/// ---------------------------------------------------------------------------
+/*! \file   SigmaDcaModel.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Compiled parameterization of the track DCA width
+ *  vs. pt.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_SIGMADCAMODEL_H
+#define SCORRELATORUTILITIES_SIGMADCAMODEL_H
+
+// c++ utilities
+#include <array>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+// phool libraries
+#include <phool/phool.h>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! DCA width parameterization
+    // ------------------------------------------------------------------------
+    /*! Evaluates Const::SigmaDcaFunc(), i.e.
+     *  [0] + [1]/x + [2]/(x*x), as compiled code.
+     *  Built from the same parameters and fit
+     *  range as Interfaces::GetSigmaDcaTF1, and
+     *  evaluated in double precision like the
+     *  TF1, so cut decisions agree. As the model
+     *  has no mutable state, a single instance
+     *  can be shared between threads.
+     */
+    class SigmaDcaModel {
+
+      private:
+
+        // data members
+        array<double, 3>   params = {0., 0., 0.};
+        pair<float, float> range  = {0., 0.};
+
+      public:
+
+        // getters
+        double             GetParameter(const size_t iPar) const {return params.at(iPar);}
+        pair<float, float> GetRange()                      const {return range;}
+
+        // public methods
+        double Eval(const double x) const {
+          return params[0] + (params[1] / x) + (params[2] / (x * x));
+        }
+        double EvalClamped(const double x, const double xMax) const {
+          return Eval(min(x, xMax));
+        }
+        double EvalClamped(const double x) const {
+          return EvalClamped(x, range.second);
+        }
+        void EvalBatch(const double* xs, double* sigmas, const size_t nVal, const double xMax) const;
+        void EvalBatch(const vector<double>& xs, vector<double>& sigmas, const double xMax) const;
+        void EvalBatch(const vector<double>& xs, vector<double>& sigmas) const;
+
+        // ctor/dtor
+        SigmaDcaModel()  {};
+        ~SigmaDcaModel() {};
+        SigmaDcaModel(const vector<float> pars, const pair<float, float> fitRange);
+
+    };  // end SigmaDcaModel def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
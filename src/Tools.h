@@ -11,6 +11,7 @@
 #define SCORRELATORUTILITIES_TOOLS_H
 
 #include "ClustTools.h"
+#include "CstTools.h"
 #include "GEvtTools.h"
 #include "ParTools.h"
 #include "REvtTools.h"
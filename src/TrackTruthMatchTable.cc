@@ -0,0 +1,165 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TrackTruthMatchTable.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event table of reco track <-> truth particle
+ *  matches.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_TRACKTRUTHMATCHTABLE_CC
+
+// class definition
+#include "TrackTruthMatchTable.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear table
+  // --------------------------------------------------------------------------
+  void Types::TrackTruthMatchTable::Reset() {
+
+    event = nullopt;
+    size  = 0;
+    store = nullptr;
+    trackOntoMatch.clear();
+    barcodeOntoTracks.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill table for the event pointed to by a context
+  // --------------------------------------------------------------------------
+  void Types::TrackTruthMatchTable::Build(Interfaces::EventContext& context, SvtxTrackEval* trackEval) {
+
+    Build(context.GetTrackMap(), trackEval, context.GetEventSequence());
+    return;
+
+  }  // end 'Build(Interfaces::EventContext&, SvtxTrackEval*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill table from a track map
+  // --------------------------------------------------------------------------
+  /*! Purity is the fraction of the track's
+   *  clusters which were contributed by the
+   *  matched particle. Unmatched tracks are
+   *  stored with a barcode of INT_MAX.
+   */
+  void Types::TrackTruthMatchTable::Build(
+    SvtxTrackMap* tracks,
+    SvtxTrackEval* trackEval,
+    optional<int> evt
+  ) {
+
+    Reset();
+    event = evt;
+    store = tracks;
+    size  = tracks -> size();
+    trackOntoMatch.reserve(size);
+    barcodeOntoTracks.reserve(size);
+
+    for (
+      SvtxTrackMap::Iter itTrk = tracks -> begin();
+      itTrk != tracks -> end();
+      ++itTrk
+    ) {
+
+      // grab track
+      SvtxTrack* track = itTrk -> second;
+      if (!track) continue;
+
+      // count clusters on track
+      const Tools::TrkHitCounts hits = Tools::GetTrackHitCounts(track);
+
+      Match match;
+      match.nClust = hits.nMvtxClust + hits.nInttClust + hits.nTpcClust;
+
+      // get best match from truth particles
+      PHG4Particle* bestMatch = trackEval -> max_truth_particle_by_nclusters(track);
+      if (bestMatch) {
+        match.barcode = bestMatch -> get_barcode();
+        match.nShared = trackEval -> get_nclusters_contribution(track, bestMatch);
+        match.purity  = (match.nClust > 0) ? ((float) match.nShared / (float) match.nClust) : 0.;
+        barcodeOntoTracks[match.barcode].push_back(track -> get_id());
+      }
+      trackOntoMatch.emplace(track -> get_id(), match);
+    }  // end track loop
+    return;
+
+  }  // end 'Build(SvtxTrackMap*, SvtxTrackEval*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check if table was built for a given event and track map
+  // --------------------------------------------------------------------------
+  /*! A table built for, or checked against, an
+   *  unknown event is never current, since the
+   *  track map alone can't tell events apart.
+   */
+  bool Types::TrackTruthMatchTable::IsCurrent(optional<int> evt, const SvtxTrackMap* tracks) const {
+
+    if (!evt.has_value() || !event.has_value()) {
+      return false;
+    }
+    return ((evt.value() == event.value()) && (tracks == store) && (tracks -> size() == size));
+
+  }  // end 'IsCurrent(optional<int>, SvtxTrackMap*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get barcode of best match for a track
+  // --------------------------------------------------------------------------
+  /*! Returns INT_MAX if the track has no match,
+   *  as Tools::GetMatchID does.
+   */
+  int Types::TrackTruthMatchTable::GetMatchID(const int trackID) const {
+
+    const Match* match = GetMatch(trackID);
+    return match ? match -> barcode : numeric_limits<int>::max();
+
+  }  // end 'GetMatchID(int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get best match for a track
+  // --------------------------------------------------------------------------
+  const Types::TrackTruthMatchTable::Match* Types::TrackTruthMatchTable::GetMatch(const int trackID) const {
+
+    auto itMatch = trackOntoMatch.find(trackID);
+    return (itMatch != trackOntoMatch.end()) ? &(itMatch -> second) : nullptr;
+
+  }  // end 'GetMatch(int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get IDs of all tracks matched to a truth particle
+  // --------------------------------------------------------------------------
+  const vector<int>& Types::TrackTruthMatchTable::GetTracks(const int barcode) const {
+
+    static const vector<int> noTracks;
+
+    auto itTracks = barcodeOntoTracks.find(barcode);
+    return (itTracks != barcodeOntoTracks.end()) ? itTracks -> second : noTracks;
+
+  }  // end 'GetTracks(int)'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,98 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TrackTruthMatchTable.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-event table of reco track <-> truth particle
+ *  matches.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TRACKTRUTHMATCHTABLE_H
+#define SCORRELATORUTILITIES_TRACKTRUTHMATCHTABLE_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+// tracking libraries
+#include <trackbase_historic/SvtxTrack.h>
+#include <trackbase_historic/SvtxTrackMap.h>
+// track evaluator utilities
+#include <g4eval/SvtxTrackEval.h>
+// phenix Geant4 utilities
+#include <g4main/PHG4Particle.h>
+// analysis utilities
+#include "Tools.h"
+#include "Interfaces.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Track-truth matching table
+    // ------------------------------------------------------------------------
+    /*! Evaluates the best truth match of every
+     *  track in an event once, and stores the
+     *  result in both directions: track ID onto
+     *  match, and truth barcode onto matched
+     *  track IDs. Matches are defined as in
+     *  Tools::GetMatchID, i.e. by the max no.
+     *  of shared clusters.
+     */
+    class TrackTruthMatchTable {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        //! Best match of a track
+        // ----------------------------------------------------------------------
+        struct Match {
+          int   barcode = numeric_limits<int>::max();
+          int   nShared = 0;
+          int   nClust  = 0;
+          float purity  = 0.;
+        };
+
+      private:
+
+        // data members
+        optional<int>                    event = nullopt;
+        size_t                           size  = 0;
+        const SvtxTrackMap*              store = nullptr;
+        unordered_map<int, Match>        trackOntoMatch;
+        unordered_map<int, vector<int>>  barcodeOntoTracks;
+
+      public:
+
+        // getters
+        size_t GetNTracks()   const {return trackOntoMatch.size();}
+        size_t GetNBarcodes() const {return barcodeOntoTracks.size();}
+
+        // public methods
+        void               Reset();
+        void               Build(Interfaces::EventContext& context, SvtxTrackEval* trackEval);
+        void               Build(SvtxTrackMap* tracks, SvtxTrackEval* trackEval, optional<int> evt = nullopt);
+        bool               IsCurrent(optional<int> evt, const SvtxTrackMap* tracks) const;
+        int                GetMatchID(const int trackID) const;
+        const Match*       GetMatch(const int trackID) const;
+        const vector<int>& GetTracks(const int barcode) const;
+
+        // ctor/dtor
+        TrackTruthMatchTable()  {};
+        ~TrackTruthMatchTable() {};
+
+    };  // end TrackTruthMatchTable def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
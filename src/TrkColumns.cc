@@ -0,0 +1,312 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TrkColumns.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for track info.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_TRKCOLUMNS_CC
+
+// class definition
+#include "TrkColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Copy a row into a TrkInfo
+  // --------------------------------------------------------------------------
+  Types::TrkInfo Types::TrkColumns::GetInfo(const size_t row) const {
+
+    TrkInfo info;
+    info.SetID( id[row] );
+    info.SetVtxID( vtxID[row] );
+    info.SetNMvtxLayer( nMvtxLayer[row] );
+    info.SetNInttLayer( nInttLayer[row] );
+    info.SetNTpcLayer( nTpcLayer[row] );
+    info.SetNMvtxClust( nMvtxClust[row] );
+    info.SetNInttClust( nInttClust[row] );
+    info.SetNTpcClust( nTpcClust[row] );
+    info.SetEta( eta[row] );
+    info.SetPhi( phi[row] );
+    info.SetEne( ene[row] );
+    info.SetPX( px[row] );
+    info.SetPY( py[row] );
+    info.SetPZ( pz[row] );
+    info.SetPT( pt[row] );
+    info.SetDcaXY( dcaXY[row] );
+    info.SetDcaZ( dcaZ[row] );
+    info.SetPtErr( ptErr[row] );
+    info.SetQuality( quality[row] );
+    info.SetVX( vx[row] );
+    info.SetVY( vy[row] );
+    info.SetVZ( vz[row] );
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Convert all rows back into a vector of TrkInfo
+  // --------------------------------------------------------------------------
+  vector<Types::TrkInfo> Types::TrkColumns::GetInfos() const {
+
+    vector<TrkInfo> infos;
+    infos.reserve( GetSize() );
+    for (size_t row = 0; row < GetSize(); ++row) {
+      infos.push_back( GetInfo(row) );
+    }
+    return infos;
+
+  }  // end 'GetInfos()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Overwrite a row with a TrkInfo
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::SetRow(const size_t row, const TrkInfo& info) {
+
+    id        [row] = info.GetID();
+    vtxID     [row] = info.GetVtxID();
+    nMvtxLayer[row] = info.GetNMvtxLayer();
+    nInttLayer[row] = info.GetNInttLayer();
+    nTpcLayer [row] = info.GetNTpcLayer();
+    nMvtxClust[row] = info.GetNMvtxClust();
+    nInttClust[row] = info.GetNInttClust();
+    nTpcClust [row] = info.GetNTpcClust();
+    eta       [row] = info.GetEta();
+    phi       [row] = info.GetPhi();
+    ene       [row] = info.GetEne();
+    px        [row] = info.GetPX();
+    py        [row] = info.GetPY();
+    pz        [row] = info.GetPZ();
+    pt        [row] = info.GetPT();
+    dcaXY     [row] = info.GetDcaXY();
+    dcaZ      [row] = info.GetDcaZ();
+    ptErr     [row] = info.GetPtErr();
+    quality   [row] = info.GetQuality();
+    vx        [row] = info.GetVX();
+    vy        [row] = info.GetVY();
+    vz        [row] = info.GetVZ();
+    return;
+
+  }  // end 'SetRow(size_t, TrkInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Replace contents with a vector of TrkInfo
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::SetInfos(const vector<TrkInfo>& infos) {
+
+    Reset();
+    Reserve( infos.size() );
+    for (const TrkInfo& info : infos) {
+      Append(info);
+    }
+    return;
+
+  }  // end 'SetInfos(vector<TrkInfo>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Add a TrkInfo as a new row
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::Append(const TrkInfo& info) {
+
+    id        .push_back( info.GetID() );
+    vtxID     .push_back( info.GetVtxID() );
+    nMvtxLayer.push_back( info.GetNMvtxLayer() );
+    nInttLayer.push_back( info.GetNInttLayer() );
+    nTpcLayer .push_back( info.GetNTpcLayer() );
+    nMvtxClust.push_back( info.GetNMvtxClust() );
+    nInttClust.push_back( info.GetNInttClust() );
+    nTpcClust .push_back( info.GetNTpcClust() );
+    eta       .push_back( info.GetEta() );
+    phi       .push_back( info.GetPhi() );
+    ene       .push_back( info.GetEne() );
+    px        .push_back( info.GetPX() );
+    py        .push_back( info.GetPY() );
+    pz        .push_back( info.GetPZ() );
+    pt        .push_back( info.GetPT() );
+    dcaXY     .push_back( info.GetDcaXY() );
+    dcaZ      .push_back( info.GetDcaZ() );
+    ptErr     .push_back( info.GetPtErr() );
+    quality   .push_back( info.GetQuality() );
+    vx        .push_back( info.GetVX() );
+    vy        .push_back( info.GetVY() );
+    vz        .push_back( info.GetVZ() );
+    return;
+
+  }  // end 'Append(TrkInfo&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reserve space in every column
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::Reserve(const size_t size) {
+
+    id.reserve(size);
+    vtxID.reserve(size);
+    nMvtxLayer.reserve(size);
+    nInttLayer.reserve(size);
+    nTpcLayer.reserve(size);
+    nMvtxClust.reserve(size);
+    nInttClust.reserve(size);
+    nTpcClust.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    dcaXY.reserve(size);
+    dcaZ.reserve(size);
+    ptErr.reserve(size);
+    quality.reserve(size);
+    vx.reserve(size);
+    vy.reserve(size);
+    vz.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Resize every column
+  // --------------------------------------------------------------------------
+  /*! New rows are maximized, matching a
+   *  default-constructed TrkInfo.
+   */
+  void Types::TrkColumns::Resize(const size_t size) {
+
+    id        .resize(size, numeric_limits<int>::max());
+    vtxID     .resize(size, numeric_limits<int>::max());
+    nMvtxLayer.resize(size, numeric_limits<int>::max());
+    nInttLayer.resize(size, numeric_limits<int>::max());
+    nTpcLayer .resize(size, numeric_limits<int>::max());
+    nMvtxClust.resize(size, numeric_limits<int>::max());
+    nInttClust.resize(size, numeric_limits<int>::max());
+    nTpcClust .resize(size, numeric_limits<int>::max());
+    eta       .resize(size, numeric_limits<double>::max());
+    phi       .resize(size, numeric_limits<double>::max());
+    ene       .resize(size, numeric_limits<double>::max());
+    px        .resize(size, numeric_limits<double>::max());
+    py        .resize(size, numeric_limits<double>::max());
+    pz        .resize(size, numeric_limits<double>::max());
+    pt        .resize(size, numeric_limits<double>::max());
+    dcaXY     .resize(size, numeric_limits<double>::max());
+    dcaZ      .resize(size, numeric_limits<double>::max());
+    ptErr     .resize(size, numeric_limits<double>::max());
+    quality   .resize(size, numeric_limits<double>::max());
+    vx        .resize(size, numeric_limits<double>::max());
+    vy        .resize(size, numeric_limits<double>::max());
+    vz        .resize(size, numeric_limits<double>::max());
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear every column
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::Reset() {
+
+    id.clear();
+    vtxID.clear();
+    nMvtxLayer.clear();
+    nInttLayer.clear();
+    nTpcLayer.clear();
+    nMvtxClust.clear();
+    nInttClust.clear();
+    nTpcClust.clear();
+    eta.clear();
+    phi.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    dcaXY.clear();
+    dcaZ.clear();
+    ptErr.clear();
+    quality.clear();
+    vx.clear();
+    vy.clear();
+    vz.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::TrkColumns::RestoreLimits() {
+
+    for (vector<Double32_t>* column : {&eta, &phi, &ene, &px, &py, &pz, &pt, &dcaXY, &dcaZ, &ptErr, &quality, &vx, &vy, &vz}) {
+      for (Double32_t& value : *column) {
+        if (isinf(value)) {
+          value = copysign(numeric_limits<double>::max(), value);
+        }
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
+  // ctor/dtor ================================================================
+
+  // --------------------------------------------------------------------------
+  //! Default class constructor
+  // --------------------------------------------------------------------------
+  Types::TrkColumns::TrkColumns() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Default class destructor
+  // --------------------------------------------------------------------------
+  Types::TrkColumns::~TrkColumns() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a vector of TrkInfo
+  // --------------------------------------------------------------------------
+  Types::TrkColumns::TrkColumns(const vector<TrkInfo>& infos) {
+
+    SetInfos(infos);
+
+  }  // end ctor(vector<TrkInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,187 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TrkColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for track info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TRKCOLUMNS_H
+#define SCORRELATORUTILITIES_TRKCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "TrkInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Track info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to TrkInfo:
+     *  each member of TrkInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  tracks only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  TrkInfo. As in TrkInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class TrkColumns {
+
+      private:
+
+        // data members
+        vector<int>        id;
+        vector<int>        vtxID;
+        vector<int>        nMvtxLayer;
+        vector<int>        nInttLayer;
+        vector<int>        nTpcLayer;
+        vector<int>        nMvtxClust;
+        vector<int>        nInttClust;
+        vector<int>        nTpcClust;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> ene;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> pt;
+        vector<Double32_t> dcaXY;
+        vector<Double32_t> dcaZ;
+        vector<Double32_t> ptErr;
+        vector<Double32_t> quality;
+        vector<Double32_t> vx;
+        vector<Double32_t> vy;
+        vector<Double32_t> vz;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as TrkInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const TrkColumns* columns = nullptr;  //!
+            size_t            index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t GetIndex()      const {return index;}
+            int    GetID()         const {return columns -> id[index];}
+            int    GetVtxID()      const {return columns -> vtxID[index];}
+            int    GetNMvtxLayer() const {return columns -> nMvtxLayer[index];}
+            int    GetNInttLayer() const {return columns -> nInttLayer[index];}
+            int    GetNTpcLayer()  const {return columns -> nTpcLayer[index];}
+            int    GetNMvtxClust() const {return columns -> nMvtxClust[index];}
+            int    GetNInttClust() const {return columns -> nInttClust[index];}
+            int    GetNTpcClust()  const {return columns -> nTpcClust[index];}
+            double GetEta()        const {return columns -> eta[index];}
+            double GetPhi()        const {return columns -> phi[index];}
+            double GetEne()        const {return columns -> ene[index];}
+            double GetPX()         const {return columns -> px[index];}
+            double GetPY()         const {return columns -> py[index];}
+            double GetPZ()         const {return columns -> pz[index];}
+            double GetPT()         const {return columns -> pt[index];}
+            double GetDcaXY()      const {return columns -> dcaXY[index];}
+            double GetDcaZ()       const {return columns -> dcaZ[index];}
+            double GetPtErr()      const {return columns -> ptErr[index];}
+            double GetQuality()    const {return columns -> quality[index];}
+            double GetVX()         const {return columns -> vx[index];}
+            double GetVY()         const {return columns -> vy[index];}
+            double GetVZ()         const {return columns -> vz[index];}
+
+            // conversion to TrkInfo
+            TrkInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator TrkInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const TrkColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&    GetID()         const {return id;}
+        const vector<int>&    GetVtxID()      const {return vtxID;}
+        const vector<int>&    GetNMvtxLayer() const {return nMvtxLayer;}
+        const vector<int>&    GetNInttLayer() const {return nInttLayer;}
+        const vector<int>&    GetNTpcLayer()  const {return nTpcLayer;}
+        const vector<int>&    GetNMvtxClust() const {return nMvtxClust;}
+        const vector<int>&    GetNInttClust() const {return nInttClust;}
+        const vector<int>&    GetNTpcClust()  const {return nTpcClust;}
+        const vector<double>& GetEta()        const {return eta;}
+        const vector<double>& GetPhi()        const {return phi;}
+        const vector<double>& GetEne()        const {return ene;}
+        const vector<double>& GetPX()         const {return px;}
+        const vector<double>& GetPY()         const {return py;}
+        const vector<double>& GetPZ()         const {return pz;}
+        const vector<double>& GetPT()         const {return pt;}
+        const vector<double>& GetDcaXY()      const {return dcaXY;}
+        const vector<double>& GetDcaZ()       const {return dcaZ;}
+        const vector<double>& GetPtErr()      const {return ptErr;}
+        const vector<double>& GetQuality()    const {return quality;}
+        const vector<double>& GetVX()         const {return vx;}
+        const vector<double>& GetVY()         const {return vy;}
+        const vector<double>& GetVZ()         const {return vz;}
+
+        // public methods
+        size_t          GetSize() const {return id.size();}
+        bool            IsEmpty() const {return id.empty();}
+        Row             GetRow(const size_t row) const {return Row(this, row);}
+        TrkInfo         GetInfo(const size_t row) const;
+        vector<TrkInfo> GetInfos() const;
+        void            SetRow(const size_t row, const TrkInfo& info);
+        void            SetInfos(const vector<TrkInfo>& infos);
+        void            Append(const TrkInfo& info);
+        void            Reserve(const size_t size);
+        void            Resize(const size_t size);
+        void            Reset();
+        void            RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        TrkColumns();
+        ~TrkColumns();
+
+        // ctor accepting arguments
+        TrkColumns(const vector<TrkInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(TrkColumns, 2)
+
+    };  // end TrkColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -105,9 +105,23 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   void Types::TrkInfo::SetInfo(SvtxTrack* track, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(track, context);
+    return;
+
+  }  // end 'SetInfo(SvtxTrack*, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A SvtxTrack using an event context
+  // --------------------------------------------------------------------------
+  void Types::TrkInfo::SetInfo(SvtxTrack* track, Interfaces::EventContext& context) {
+
     // do relevant calculations
-    const ROOT::Math::XYZVector trkVtx     = Tools::GetTrackVertex(track, topNode);
-    const pair<double, double>  trkDcaPair = Tools::GetTrackDcaPair(track, topNode);
+    const ROOT::Math::XYZVector trkVtx     = Tools::GetTrackVertex(track, context);
+    const pair<double, double>  trkDcaPair = Tools::GetTrackDcaPair(track, context);
+    const Tools::TrkHitCounts   trkHits    = Tools::GetTrackHitCounts(track);
 
     // set track info
     id         = track -> get_id();
@@ -125,16 +139,16 @@ namespace SColdQcdCorrelatorAnalysis {
     vz         = trkVtx.z();
     dcaXY      = trkDcaPair.first;
     dcaZ       = trkDcaPair.second;
-    nMvtxLayer = Tools::GetNumLayer(track, Const::Subsys::Mvtx);
-    nInttLayer = Tools::GetNumLayer(track, Const::Subsys::Intt);
-    nTpcLayer  = Tools::GetNumLayer(track, Const::Subsys::Tpc);
-    nMvtxClust = Tools::GetNumClust(track, Const::Subsys::Mvtx);
-    nInttClust = Tools::GetNumClust(track, Const::Subsys::Intt);
-    nTpcClust  = Tools::GetNumClust(track, Const::Subsys::Tpc);
+    nMvtxLayer = trkHits.nMvtxLayer;
+    nInttLayer = trkHits.nInttLayer;
+    nTpcLayer  = trkHits.nTpcLayer;
+    nMvtxClust = trkHits.nMvtxClust;
+    nInttClust = trkHits.nInttClust;
+    nTpcClust  = trkHits.nTpcClust;
     ptErr      = Tools::GetTrackDeltaPt(track);
     return;
 
-  }  // end 'SetInfo(SvtxTrack*, PHCompositeNode*)'
+  }  // end 'SetInfo(SvtxTrack*, EventContext&)'
 
 
 
@@ -183,16 +197,63 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Check if track is within sigma-dca cut using compiled models
+  // --------------------------------------------------------------------------
+  bool Types::TrkInfo::IsInSigmaDcaCut(
+    const pair<float, float> nSigCut,
+    const pair<float, float> ptFitMax,
+    const pair<SigmaDcaModel, SigmaDcaModel>& fSigmaDca
+  ) const {
+
+    // if above max pt used to fit dca width, use value of fit at max pt
+    const bool isInDcaRangeXY  = (abs(dcaXY) < (nSigCut.first  * fSigmaDca.first.EvalClamped(pt, ptFitMax.first)));
+    const bool isInDcaRangeZ   = (abs(dcaZ)  < (nSigCut.second * fSigmaDca.second.EvalClamped(pt, ptFitMax.second)));
+    const bool isInSigmaDcaCut = (isInDcaRangeXY && isInDcaRangeZ);
+    return isInSigmaDcaCut;
+
+  }  // end 'IsInSigmaDcaCut(pair<float, float>, pair<float, float>, pair<SigmaDcaModel, SigmaDcaModel>&)'
+
+
+
   // --------------------------------------------------------------------------
   //! Check if object is from the primary vertex
   // --------------------------------------------------------------------------
   bool Types::TrkInfo::IsFromPrimaryVtx(PHCompositeNode* topNode) {
 
-    GlobalVertex* primVtx   = Interfaces::GetGlobalVertex(topNode);
+    Interfaces::EventContext context(topNode);
+    return IsFromPrimaryVtx(context);
+
+  }  // end 'IsFromPrimaryVtx(PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check if object is from the primary vertex using an event context
+  // --------------------------------------------------------------------------
+  bool Types::TrkInfo::IsFromPrimaryVtx(Interfaces::EventContext& context) {
+
+    GlobalVertex* primVtx   = context.GetGlobalVertex();
     const int     primVtxID = primVtx -> get_id();
     return (vtxID == primVtxID);
 
-  }  // end 'IsFromPrimaryVtx(PHCompositeNode*)'
+  }  // end 'IsFromPrimaryVtx(EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::TrkInfo::RestoreLimits() {
+
+    for (double* member : {&eta, &phi, &ene, &px, &py, &pz, &pt, &dcaXY, &dcaZ, &ptErr, &quality, &vx, &vy, &vz}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
 
 
 
@@ -425,6 +486,17 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(SvtxTrack*, PHCompositeNode*)'
 
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A SvtxTrack and an event context
+  // --------------------------------------------------------------------------
+  Types::TrkInfo::TrkInfo(SvtxTrack* track, Interfaces::EventContext& context) {
+
+    SetInfo(track, context);
+
+  }  // end ctor(SvtxTrack*, EventContext&)'
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
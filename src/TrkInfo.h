@@ -27,6 +27,7 @@
 // analysis utilities
 #include "TrkTools.h"
 #include "Constants.h"
+#include "SigmaDcaModel.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -48,28 +49,28 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int    id         = numeric_limits<int>::max();
-        int    vtxID      = numeric_limits<int>::max();
-        int    nMvtxLayer = numeric_limits<int>::max();
-        int    nInttLayer = numeric_limits<int>::max();
-        int    nTpcLayer  = numeric_limits<int>::max();
-        int    nMvtxClust = numeric_limits<int>::max();
-        int    nInttClust = numeric_limits<int>::max();
-        int    nTpcClust  = numeric_limits<int>::max();
-        double eta        = numeric_limits<double>::max();
-        double phi        = numeric_limits<double>::max();
-        double ene        = numeric_limits<double>::max();
-        double px         = numeric_limits<double>::max();
-        double py         = numeric_limits<double>::max();
-        double pz         = numeric_limits<double>::max();
-        double pt         = numeric_limits<double>::max();
-        double dcaXY      = numeric_limits<double>::max();
-        double dcaZ       = numeric_limits<double>::max();
-        double ptErr      = numeric_limits<double>::max();
-        double quality    = numeric_limits<double>::max();
-        double vx         = numeric_limits<double>::max();
-        double vy         = numeric_limits<double>::max();
-        double vz         = numeric_limits<double>::max();
+        int        id         = numeric_limits<int>::max();
+        int        vtxID      = numeric_limits<int>::max();
+        int        nMvtxLayer = numeric_limits<int>::max();
+        int        nInttLayer = numeric_limits<int>::max();
+        int        nTpcLayer  = numeric_limits<int>::max();
+        int        nMvtxClust = numeric_limits<int>::max();
+        int        nInttClust = numeric_limits<int>::max();
+        int        nTpcClust  = numeric_limits<int>::max();
+        Double32_t eta        = numeric_limits<double>::max();
+        Double32_t phi        = numeric_limits<double>::max();
+        Double32_t ene        = numeric_limits<double>::max();
+        Double32_t px         = numeric_limits<double>::max();
+        Double32_t py         = numeric_limits<double>::max();
+        Double32_t pz         = numeric_limits<double>::max();
+        Double32_t pt         = numeric_limits<double>::max();
+        Double32_t dcaXY      = numeric_limits<double>::max();
+        Double32_t dcaZ       = numeric_limits<double>::max();
+        Double32_t ptErr      = numeric_limits<double>::max();
+        Double32_t quality    = numeric_limits<double>::max();
+        Double32_t vx         = numeric_limits<double>::max();
+        Double32_t vy         = numeric_limits<double>::max();
+        Double32_t vz         = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -128,10 +129,14 @@ namespace SColdQcdCorrelatorAnalysis {
         // public methods
         void Reset();
         void SetInfo(SvtxTrack* track, PHCompositeNode* topNode);
+        void SetInfo(SvtxTrack* track, Interfaces::EventContext& context);
         bool IsInAcceptance(const TrkInfo& minimum, const TrkInfo& maximum) const;
         bool IsInAcceptance(const pair<TrkInfo, TrkInfo>& range) const;
+        void RestoreLimits();
         bool IsInSigmaDcaCut(const pair<float, float> nSigCut, const pair<float, float> ptFitMax, const pair<TF1*, TF1*> fSigmaDca) const;
+        bool IsInSigmaDcaCut(const pair<float, float> nSigCut, const pair<float, float> ptFitMax, const pair<SigmaDcaModel, SigmaDcaModel>& fSigmaDca) const;
         bool IsFromPrimaryVtx(PHCompositeNode* topNode);
+        bool IsFromPrimaryVtx(Interfaces::EventContext& context);
 
         // static methods
         static vector<string> GetListOfMembers();
@@ -149,9 +154,10 @@ namespace SColdQcdCorrelatorAnalysis {
         // ctors accepting arguments
         TrkInfo(const Const::Init init);
         TrkInfo(SvtxTrack* track, PHCompositeNode* topNode);
+        TrkInfo(SvtxTrack* track, Interfaces::EventContext& context);
 
       // identify this class to ROOT
-      ClassDefNV(TrkInfo, 1);
+      ClassDefNV(TrkInfo, 2);
 
     };  // end TrkInfo def
 
@@ -23,78 +23,103 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
 
   // --------------------------------------------------------------------------
-  //! Get no. of layers hit from a specific subsystem
+  //! Get no. of layers hit and clusters from all tracking subsystems
   // --------------------------------------------------------------------------
-  int Tools::GetNumLayer(SvtxTrack* track, const int16_t sys) {
+  /*! Walks the silicon and TPC seed cluster keys
+   *  once, flagging hit layers in fixed-width
+   *  bitmasks and counting clusters along the way.
+   *  Seeds are selected as in GetTrackSeed: the
+   *  MVTX & INTT are read from the silicon seed if
+   *  both seeds are present, or from the TPC seed
+   *  if only that one is.
+   */
+  Tools::TrkHitCounts Tools::GetTrackHitCounts(SvtxTrack* track) {
+
+    // get both track seeds
+    TrackSeed* trkSiSeed  = track -> get_silicon_seed();
+    TrackSeed* trkTpcSeed = track -> get_tpc_seed();
 
-    // grab track seed
-    TrackSeed* seed = GetTrackSeed(track, sys);
+    // select seed for silicon layers
+    TrackSeed* siSeed = NULL;
+    if (trkSiSeed && trkTpcSeed)  siSeed = trkSiSeed;
+    if (!trkSiSeed && trkTpcSeed) siSeed = trkTpcSeed;
 
     // set min no. of layers
     const int minInttLayer = Const::NMvtxLayer();
     const int minTpcLayer  = Const::NMvtxLayer() + Const::NInttLayer();
+    const int maxTpcLayer  = minTpcLayer + Const::NTpcLayer();
+
+    // hit flags & counts
+    uint64_t     mvtxLayers = 0;
+    uint64_t     inttLayers = 0;
+    uint64_t     tpcLayers  = 0;
+    TrkHitCounts counts;
+
+    // walk silicon seed: only mvtx & intt clusters count
+    // unless it's also the tpc seed
+    if (siSeed) {
+      const bool countTpc = (siSeed == trkTpcSeed);
+      for (
+        auto itClustKey = (siSeed -> begin_cluster_keys());
+        itClustKey != (siSeed -> end_cluster_keys());
+        ++itClustKey
+      ) {
+        const int layer = TrkrDefs::getLayer(*itClustKey);
+        if (layer < minInttLayer) {
+          mvtxLayers |= (uint64_t(1) << layer);
+          ++counts.nMvtxClust;
+        } else if (layer < minTpcLayer) {
+          inttLayers |= (uint64_t(1) << (layer - minInttLayer));
+          ++counts.nInttClust;
+        } else if (countTpc) {
+          if (layer < maxTpcLayer) tpcLayers |= (uint64_t(1) << (layer - minTpcLayer));
+          ++counts.nTpcClust;
+        }
+      }  // end cluster loop
+    }
 
-    // initialize hit flags
-    vector<bool> isMvtxLayerHit( Const::NMvtxLayer(), false );
-    vector<bool> isInttLayerHit( Const::NInttLayer(), false );
-    vector<bool> isTpcLayerHit(  Const::NTpcLayer(),  false  );
+    // walk tpc seed if not already done
+    if (trkTpcSeed && (trkTpcSeed != siSeed)) {
+      for (
+        auto itClustKey = (trkTpcSeed -> begin_cluster_keys());
+        itClustKey != (trkTpcSeed -> end_cluster_keys());
+        ++itClustKey
+      ) {
+        const int layer = TrkrDefs::getLayer(*itClustKey);
+        if (layer >= minTpcLayer) {
+          if (layer < maxTpcLayer) tpcLayers |= (uint64_t(1) << (layer - minTpcLayer));
+          ++counts.nTpcClust;
+        }
+      }  // end cluster loop
+    }
+
+    // count hit layers
+    counts.nMvtxLayer = bitset<64>(mvtxLayers).count();
+    counts.nInttLayer = bitset<64>(inttLayers).count();
+    counts.nTpcLayer  = bitset<64>(tpcLayers).count();
+    return counts;
+
+  }  // end 'GetTrackHitCounts(SvtxTrack*)'
 
-    // determine which layers were hit
-    int layer     = 0;
-    int mvtxLayer = 0;
-    int inttLayer = 0;
-    int tpcLayer  = 0;
-    for (
-      auto itClustKey = (seed -> begin_cluster_keys());
-      itClustKey != (seed -> end_cluster_keys());
-      ++itClustKey
-    ) {
 
-      // grab layer number
-      layer = TrkrDefs::getLayer(*itClustKey);
-
-      // increment accordingly
-      switch (sys) {
-        case Const::Subsys::Mvtx:
-          if (layer < Const::NMvtxLayer()) {
-            mvtxLayer                 = layer;
-            isMvtxLayerHit[mvtxLayer] = true;
-          }
-          break;
-        case Const::Subsys::Intt:
-          if ((layer >= minInttLayer) && (layer < minTpcLayer)) {
-            inttLayer                 = layer - minInttLayer;
-            isInttLayerHit[inttLayer] = true;
-          }
-          break;
-        case Const::Subsys::Tpc:
-          if (layer >= minTpcLayer) {
-            tpcLayer                = layer - minTpcLayer;
-            isTpcLayerHit[tpcLayer] = true;
-          }
-          break;
-        default:
-          break;
-      }
-    }  // end cluster loop
 
-    // get the relevant no. of layers
+  // --------------------------------------------------------------------------
+  //! Get no. of layers hit from a specific subsystem
+  // --------------------------------------------------------------------------
+  int Tools::GetNumLayer(SvtxTrack* track, const int16_t sys) {
+
+    const TrkHitCounts counts = GetTrackHitCounts(track);
+
     int nLayer = 0;
     switch (sys) {
       case Const::Subsys::Mvtx:
-        for (int iMvtxLayer = 0; iMvtxLayer < Const::NMvtxLayer(); iMvtxLayer++) {
-          if (isMvtxLayerHit[iMvtxLayer]) ++nLayer;
-        }
+        nLayer = counts.nMvtxLayer;
         break;
       case Const::Subsys::Intt:
-        for (int iInttLayer = 0; iInttLayer < Const::NInttLayer(); iInttLayer++) {
-          if (isInttLayerHit[iInttLayer]) ++nLayer;
-        }
+        nLayer = counts.nInttLayer;
         break;
       case Const::Subsys::Tpc:
-        for (int iTpcLayer = 0; iTpcLayer < Const::NTpcLayer(); iTpcLayer++) {
-          if (isTpcLayerHit[iTpcLayer]) ++nLayer;
-        }
+        nLayer = counts.nTpcLayer;
         break;
       default:
         break;
@@ -110,42 +135,22 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   int Tools::GetNumClust(SvtxTrack* track, const int16_t sys) {
 
-    // grab track seed
-    TrackSeed* seed = GetTrackSeed(track, sys);
+    const TrkHitCounts counts = GetTrackHitCounts(track);
 
-    // set min no. of layers
-    const int minInttLayer = Const::NMvtxLayer();
-    const int minTpcLayer  = Const::NMvtxLayer() + Const::NInttLayer();
-
-    // determine no. of clusters for a given layer
-    int layer    = 0;
     int nCluster = 0;
-    for (auto itClustKey = (seed -> begin_cluster_keys()); itClustKey != (seed -> end_cluster_keys()); ++itClustKey) {
-
-      // grab layer number
-      layer = TrkrDefs::getLayer(*itClustKey);
-
-      // increment accordingly
-      switch (sys) {
-        case Const::Subsys::Mvtx:
-          if (layer < Const::NMvtxLayer()) {
-            ++nCluster;
-          }
-          break;
-        case Const::Subsys::Intt:
-          if ((layer >= minInttLayer) && (layer < minTpcLayer)) {
-            ++nCluster;
-          }
-          break;
-        case Const::Subsys::Tpc:
-          if (layer >= minTpcLayer) {
-            ++nCluster;
-          }
-          break;
-        default:
-          break;
-      }
-    }  // end cluster loop
+    switch (sys) {
+      case Const::Subsys::Mvtx:
+        nCluster = counts.nMvtxClust;
+        break;
+      case Const::Subsys::Intt:
+        nCluster = counts.nInttClust;
+        break;
+      case Const::Subsys::Tpc:
+        nCluster = counts.nTpcClust;
+        break;
+      default:
+        break;
+    }
     return nCluster;
 
   }  // end 'GetNumClust(SvtxTrack*, int16_t)'
@@ -198,18 +203,30 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   bool Tools::IsFromPrimaryVtx(SvtxTrack* track, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return IsFromPrimaryVtx(track, context);
+
+  }  // end 'IsFromPrimaryVtx(SvtTrack*, PHCompsiteNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Is track connected to the primary vertex? (using an event context)
+  // --------------------------------------------------------------------------
+  bool Tools::IsFromPrimaryVtx(SvtxTrack* track, Interfaces::EventContext& context) {
+
     // get id of vertex associated with track
     const int vtxID = (int) track -> get_vertex_id();
 
     // get id of primary vertex
-    GlobalVertex* primVtx   = Interfaces::GetGlobalVertex(topNode);
+    GlobalVertex* primVtx   = context.GetGlobalVertex();
     const int     primVtxID = primVtx -> get_id();
 
     // check if from vertex and return
     const bool isFromPrimVtx = (vtxID == primVtxID);
     return isFromPrimVtx;
 
-  }  // end 'IsFromPrimaryVtx(SvtTrack*, PHCompsiteNode*)'
+  }  // end 'IsFromPrimaryVtx(SvtTrack*, EventContext&)'
 
 
 
@@ -244,15 +261,38 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   pair<double, double> Tools::GetTrackDcaPair(SvtxTrack* track, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetTrackDcaPair(track, context);
+
+  }  // end 'GetTrackDcaPair(SvtxTrack*, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get track XY and Z DCA using an event context
+  // --------------------------------------------------------------------------
+  pair<double, double> Tools::GetTrackDcaPair(SvtxTrack* track, Interfaces::EventContext& context) {
+
     // get global vertex and convert to acts vector
-    GlobalVertex* sphxVtx = Interfaces::GetGlobalVertex(topNode);
-    Acts::Vector3 actsVtx = Acts::Vector3(sphxVtx -> get_x(), sphxVtx -> get_y(), sphxVtx -> get_z());
+    GlobalVertex* sphxVtx = context.GetGlobalVertex();
+    return GetTrackDcaPair(
+      track,
+      Acts::Vector3(sphxVtx -> get_x(), sphxVtx -> get_y(), sphxVtx -> get_z())
+    );
+
+  }  // end 'GetTrackDcaPair(SvtxTrack*, EventContext&)'
 
-    // return dca
-    const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, actsVtx);
+
+
+  // --------------------------------------------------------------------------
+  //! Get track dca wrt a provided vertex
+  // --------------------------------------------------------------------------
+  pair<double, double> Tools::GetTrackDcaPair(SvtxTrack* track, Acts::Vector3 vtx) {
+
+    const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, vtx);
     return make_pair(dcaAndErr.first.first, dcaAndErr.second.first);
 
-  }  // end 'GetTrackDcaPair(SvtxTrack*, PHCompositeNode*)'
+  }  // end 'GetTrackDcaPair(SvtxTrack*, Acts::Vector3)'
 
 
 
@@ -297,15 +337,170 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   ROOT::Math::XYZVector Tools::GetTrackVertex(SvtxTrack* track, PHCompositeNode* topNode) {
 
+    Interfaces::EventContext context(topNode);
+    return GetTrackVertex(track, context);
+
+  }  // end 'GetTrackVertex(SvtxTrack*, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get track's associated vertex using an event context
+  // --------------------------------------------------------------------------
+  ROOT::Math::XYZVector Tools::GetTrackVertex(SvtxTrack* track, Interfaces::EventContext& context) {
+
     // get vertex associated with track
     const int     vtxID = (int) track -> get_vertex_id();
-    GlobalVertex* vtx   = Interfaces::GetGlobalVertex(topNode, vtxID);
+    GlobalVertex* vtx   = context.GetGlobalVertex(vtxID);
 
     // return vertex 3-vector
     ROOT::Math::XYZVector xyzVtx = ROOT::Math::XYZVector(vtx -> get_x(), vtx -> get_y(), vtx -> get_z());
     return xyzVtx;
 
-  }  // end 'GetTrackVertex(SvtxTrack*, PHCompositeNode*)'
+  }  // end 'GetTrackVertex(SvtxTrack*, EventContext&)'
+
+
+
+  // batched track methods ====================================================
+
+  // --------------------------------------------------------------------------
+  //! Get dca of all tracks in an event
+  // --------------------------------------------------------------------------
+  vector<pair<double, double>> Tools::GetTrackDcaPairs(PHCompositeNode* topNode, const bool useTrackVtx) {
+
+    Interfaces::EventContext context(topNode);
+    return GetTrackDcaPairs(context, useTrackVtx);
+
+  }  // end 'GetTrackDcaPairs(PHCompositeNode*, bool)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get dca of all tracks in an event using an event context
+  // --------------------------------------------------------------------------
+  /*! If useTrackVtx is false, all tracks are
+   *  evaluated against the first global vertex
+   *  (as in GetTrackDcaPair). Otherwise each
+   *  track is evaluated against its own vertex.
+   *  Entries run parallel to the track map.
+   */
+  vector<pair<double, double>> Tools::GetTrackDcaPairs(Interfaces::EventContext& context, const bool useTrackVtx) {
+
+    vector<pair<double, double>> dcas;
+    if (useTrackVtx) {
+      GetTrackDcaPairs(context.GetTrackMap(), context.GetVertexMap(), dcas);
+    } else {
+      GlobalVertex* sphxVtx = context.GetGlobalVertex();
+      GetTrackDcaPairs(
+        context.GetTrackMap(),
+        Acts::Vector3(sphxVtx -> get_x(), sphxVtx -> get_y(), sphxVtx -> get_z()),
+        dcas
+      );
+    }
+    return dcas;
+
+  }  // end 'GetTrackDcaPairs(EventContext&, bool)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill dca of all tracks in a map wrt a shared vertex
+  // --------------------------------------------------------------------------
+  /*! Entries run parallel to the track map; null
+   *  tracks get a (max, max) sentinel. The provided
+   *  vector is cleared, but keeps its capacity so
+   *  it can be reused between events.
+   */
+  void Tools::GetTrackDcaPairs(
+    SvtxTrackMap* tracks,
+    Acts::Vector3 vtx,
+    vector<pair<double, double>>& dcas
+  ) {
+
+    dcas.clear();
+    dcas.reserve(tracks -> size());
+    for (
+      SvtxTrackMap::Iter itTrk = tracks -> begin();
+      itTrk != tracks -> end();
+      ++itTrk
+    ) {
+
+      // grab track
+      SvtxTrack* track = itTrk -> second;
+      if (!track) {
+        dcas.emplace_back(numeric_limits<double>::max(), numeric_limits<double>::max());
+        continue;
+      }
+
+      const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, vtx);
+      dcas.emplace_back(dcaAndErr.first.first, dcaAndErr.second.first);
+    }
+    return;
+
+  }  // end 'GetTrackDcaPairs(SvtxTrackMap*, Acts::Vector3, vector<pair<double, double>>&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill dca of all tracks in a map wrt each track's vertex
+  // --------------------------------------------------------------------------
+  /*! Vertices are converted once per event into a
+   *  table keyed by vertex ID. Entries run parallel
+   *  to the track map; null tracks and tracks whose
+   *  vertex isn't in the map get a (max, max)
+   *  sentinel.
+   */
+  void Tools::GetTrackDcaPairs(
+    SvtxTrackMap* tracks,
+    GlobalVertexMap* vertices,
+    vector<pair<double, double>>& dcas
+  ) {
+
+    // build vertex table
+    unordered_map<unsigned int, Acts::Vector3> vtxTable;
+    vtxTable.reserve(vertices -> size());
+    for (
+      GlobalVertexMap::Iter itVtx = vertices -> begin();
+      itVtx != vertices -> end();
+      ++itVtx
+    ) {
+      GlobalVertex* vtx = itVtx -> second;
+      if (!vtx) continue;
+      vtxTable.emplace(
+        itVtx -> first,
+        Acts::Vector3(vtx -> get_x(), vtx -> get_y(), vtx -> get_z())
+      );
+    }
+
+    // now evaluate dca of each track
+    dcas.clear();
+    dcas.reserve(tracks -> size());
+    for (
+      SvtxTrackMap::Iter itTrk = tracks -> begin();
+      itTrk != tracks -> end();
+      ++itTrk
+    ) {
+
+      // grab track & its vertex
+      SvtxTrack* track = itTrk -> second;
+      if (!track) {
+        dcas.emplace_back(numeric_limits<double>::max(), numeric_limits<double>::max());
+        continue;
+      }
+
+      auto itVtx = vtxTable.find(track -> get_vertex_id());
+      if (itVtx == vtxTable.end()) {
+        dcas.emplace_back(numeric_limits<double>::max(), numeric_limits<double>::max());
+        continue;
+      }
+
+      const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, itVtx -> second);
+      dcas.emplace_back(dcaAndErr.first.first, dcaAndErr.second.first);
+    }
+    return;
+
+  }  // end 'GetTrackDcaPairs(SvtxTrackMap*, GlobalVertexMap*, vector<pair<double, double>>&)'
+
 
 }  // end SColdQcdCorrealtorAnalysis namespace
 
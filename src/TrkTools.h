@@ -13,11 +13,14 @@
 
 // c++ utilities
 #include <array>
+#include <bitset>
 #include <limits>
 #include <string>
 #include <vector>
 #include <cassert>
+#include <cstdint>
 #include <utility>
+#include <unordered_map>
 // root utilities
 #include <Math/Vector3D.h>
 // phool libraries
@@ -34,6 +37,7 @@
 #include <g4eval/SvtxTrackEval.h>
 // vertex libraries
 #include <globalvertex/GlobalVertex.h>
+#include <globalvertex/GlobalVertexMap.h>
 // phenix Geant4 utilities
 #include <g4main/PHG4Particle.h>
 // analysis utilities
@@ -48,17 +52,40 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // ------------------------------------------------------------------------
+    //! No. of layers hit & clusters per tracking subsystem
+    // ------------------------------------------------------------------------
+    struct TrkHitCounts {
+      int nMvtxLayer = 0;
+      int nInttLayer = 0;
+      int nTpcLayer  = 0;
+      int nMvtxClust = 0;
+      int nInttClust = 0;
+      int nTpcClust  = 0;
+    };
+
     // track methods ----------------------------------------------------------
 
     int                   GetNumLayer(SvtxTrack* track, const int16_t sys = 0);
     int                   GetNumClust(SvtxTrack* track, const int16_t sys = 0);
+    TrkHitCounts          GetTrackHitCounts(SvtxTrack* track);
     int                   GetMatchID(SvtxTrack* track, SvtxTrackEval* trackEval);
     bool                  IsGoodTrackSeed(SvtxTrack* track, const bool requireSiSeeds = true);
     bool                  IsFromPrimaryVtx(SvtxTrack* track, PHCompositeNode* topNode);
+    bool                  IsFromPrimaryVtx(SvtxTrack* track, Interfaces::EventContext& context);
     double                GetTrackDeltaPt(SvtxTrack* track);
     TrackSeed*            GetTrackSeed(SvtxTrack* track, const int16_t sys);
     pair<double, double>  GetTrackDcaPair(SvtxTrack* track, PHCompositeNode* topNode);
+    pair<double, double>  GetTrackDcaPair(SvtxTrack* track, Interfaces::EventContext& context);
+    pair<double, double>  GetTrackDcaPair(SvtxTrack* track, Acts::Vector3 vtx);
     ROOT::Math::XYZVector GetTrackVertex(SvtxTrack* track, PHCompositeNode* topNode);
+    ROOT::Math::XYZVector GetTrackVertex(SvtxTrack* track, Interfaces::EventContext& context);
+
+    // batched track methods
+    vector<pair<double, double>> GetTrackDcaPairs(PHCompositeNode* topNode, const bool useTrackVtx = false);
+    vector<pair<double, double>> GetTrackDcaPairs(Interfaces::EventContext& context, const bool useTrackVtx = false);
+    void                         GetTrackDcaPairs(SvtxTrackMap* tracks, Acts::Vector3 vtx, vector<pair<double, double>>& dcas);
+    void                         GetTrackDcaPairs(SvtxTrackMap* tracks, GlobalVertexMap* vertices, vector<pair<double, double>>& dcas);
 
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
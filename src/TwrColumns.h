@@ -0,0 +1,163 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TwrColumns.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Column-wise (structure-of-arrays) container
+ *  for tower info.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TWRCOLUMNS_H
+#define SCORRELATORUTILITIES_TWRCOLUMNS_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "TwrInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ------------------------------------------------------------------------
+    //! Tower info, stored column-wise
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays companion to TwrInfo:
+     *  each member of TwrInfo is kept in its own
+     *  contiguous vector, so loops over
+     *  calorimeter towers only touch the members
+     *  they need. Rows can be read back
+     *  through a Row view or converted to
+     *  TwrInfo. As in TwrInfo, kinematic
+     *  columns are stored as Double32_t.
+     */
+    class TwrColumns {
+
+      private:
+
+        // data members
+        vector<int>        system;
+        vector<int>        status;
+        vector<int>        channel;
+        vector<int>        id;
+        vector<Double32_t> ene;
+        vector<Double32_t> rho;
+        vector<Double32_t> eta;
+        vector<Double32_t> phi;
+        vector<Double32_t> px;
+        vector<Double32_t> py;
+        vector<Double32_t> pz;
+        vector<Double32_t> rx;
+        vector<Double32_t> ry;
+        vector<Double32_t> rz;
+
+      public:
+
+        // --------------------------------------------------------------------
+        //! Read-only view of a single row
+        // --------------------------------------------------------------------
+        /*! Exposes the same getters as TwrInfo.
+         *  Only valid while the parent columns
+         *  are alive and not resized.
+         */
+        class Row {
+
+          private:
+
+            // data members
+            const TwrColumns* columns = nullptr;  //!
+            size_t            index   = 0;        //!
+
+          public:
+
+            // getters
+            size_t GetIndex()   const {return index;}
+            int    GetSystem()  const {return columns -> system[index];}
+            int    GetStatus()  const {return columns -> status[index];}
+            int    GetChannel() const {return columns -> channel[index];}
+            int    GetID()      const {return columns -> id[index];}
+            double GetEne()     const {return columns -> ene[index];}
+            double GetRho()     const {return columns -> rho[index];}
+            double GetEta()     const {return columns -> eta[index];}
+            double GetPhi()     const {return columns -> phi[index];}
+            double GetPX()      const {return columns -> px[index];}
+            double GetPY()      const {return columns -> py[index];}
+            double GetPZ()      const {return columns -> pz[index];}
+            double GetRX()      const {return columns -> rx[index];}
+            double GetRY()      const {return columns -> ry[index];}
+            double GetRZ()      const {return columns -> rz[index];}
+
+            // conversion to TwrInfo
+            TwrInfo GetInfo() const {return columns -> GetInfo(index);}
+            operator TwrInfo() const {return GetInfo();}
+
+            // default ctor/dtor
+            Row()  {};
+            ~Row() {};
+
+            // ctor accepting arguments
+            Row(const TwrColumns* cols, const size_t row) : columns(cols), index(row) {};
+
+        };  // end Row def
+
+        // column getters
+        const vector<int>&    GetSystem()  const {return system;}
+        const vector<int>&    GetStatus()  const {return status;}
+        const vector<int>&    GetChannel() const {return channel;}
+        const vector<int>&    GetID()      const {return id;}
+        const vector<double>& GetEne()     const {return ene;}
+        const vector<double>& GetRho()     const {return rho;}
+        const vector<double>& GetEta()     const {return eta;}
+        const vector<double>& GetPhi()     const {return phi;}
+        const vector<double>& GetPX()      const {return px;}
+        const vector<double>& GetPY()      const {return py;}
+        const vector<double>& GetPZ()      const {return pz;}
+        const vector<double>& GetRX()      const {return rx;}
+        const vector<double>& GetRY()      const {return ry;}
+        const vector<double>& GetRZ()      const {return rz;}
+
+        // public methods
+        size_t          GetSize() const {return system.size();}
+        bool            IsEmpty() const {return system.empty();}
+        Row             GetRow(const size_t row) const {return Row(this, row);}
+        TwrInfo         GetInfo(const size_t row) const;
+        vector<TwrInfo> GetInfos() const;
+        void            SetRow(const size_t row, const TwrInfo& info);
+        void            SetInfos(const vector<TwrInfo>& infos);
+        void            Append(const TwrInfo& info);
+        void            Reserve(const size_t size);
+        void            Resize(const size_t size);
+        void            Reset();
+        void            RestoreLimits();
+
+        // overloaded operators
+        Row operator [](const size_t row) const {return GetRow(row);}
+
+        // default ctor/dtor
+        TwrColumns();
+        ~TwrColumns();
+
+        // ctor accepting arguments
+        TwrColumns(const vector<TwrInfo>& infos);
+
+      // identify this class to ROOT
+      ClassDefNV(TwrColumns, 2)
+
+    };  // end TwrColumns def
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,238 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TwrGeoTable.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-run cache of calorimeter tower geometry.
+ */
+/// ---------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_TWRGEOTABLE_CC
+
+// class definition
+#include "TwrGeoTable.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // private methods ==========================================================
+
+  // --------------------------------------------------------------------------
+  //! Append a tower to the table
+  // --------------------------------------------------------------------------
+  void Interfaces::TwrGeoTable::Add(
+    const int keyTwr,
+    const int iEta,
+    const int iPhi,
+    const int keyRaw,
+    const RawTowerGeom* geometry
+  ) {
+
+    // towers without a geometry get NaN positions
+    const float nan = numeric_limits<float>::quiet_NaN();
+    if (!geometry) ++nMissing;
+
+    rawKeyOntoEntry.emplace(keyRaw, (uint32_t) rawKey.size());
+    towerKey.push_back(keyTwr);
+    etaBin.push_back(iEta);
+    phiBin.push_back(iPhi);
+    rawKey.push_back(keyRaw);
+    x.push_back(geometry ? geometry -> get_center_x() : nan);
+    y.push_back(geometry ? geometry -> get_center_y() : nan);
+    z.push_back(geometry ? geometry -> get_center_z() : nan);
+    radius.push_back(geometry ? geometry -> get_center_radius() : nan);
+    phi.push_back(geometry ? atan2(geometry -> get_center_y(), geometry -> get_center_x()) : nan);
+    return;
+
+  }  // end 'Add(int, int, int, int, RawTowerGeom*)'
+
+
+
+  // public methods ===========================================================
+
+  // --------------------------------------------------------------------------
+  //! Clear all columns
+  // --------------------------------------------------------------------------
+  void Interfaces::TwrGeoTable::Reset() {
+
+    geometries = nullptr;
+    byChannel  = false;
+    nMissing   = 0;
+    rawKeyOntoEntry.clear();
+    towerKey.clear();
+    etaBin.clear();
+    phiBin.clear();
+    rawKey.clear();
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+    phi.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill columns from a geometry container
+  // --------------------------------------------------------------------------
+  /*! If a TowerInfo container is provided, entry
+   *  i of each column corresponds to channel i of
+   *  that container. Otherwise, the table is
+   *  filled in the order of the geometry container
+   *  and tower keys & bins are taken from the
+   *  raw tower key.
+   */
+  void Interfaces::TwrGeoTable::Build(
+    const int sys,
+    RawTowerGeomContainer* geo,
+    TowerInfoContainer* twr
+  ) {
+
+    Reset();
+    geometries = geo;
+    byChannel  = (twr != nullptr);
+
+    if (byChannel) {
+
+      const size_t nChan = twr -> size();
+      rawKeyOntoEntry.reserve(nChan);
+      towerKey.reserve(nChan);
+      etaBin.reserve(nChan);
+      phiBin.reserve(nChan);
+      rawKey.reserve(nChan);
+      x.reserve(nChan);
+      y.reserve(nChan);
+      z.reserve(nChan);
+      radius.reserve(nChan);
+      phi.reserve(nChan);
+
+      for (size_t iChan = 0; iChan < nChan; ++iChan) {
+
+        // get tower key & indices
+        const uint32_t keyTwr = twr -> encode_key(iChan);
+        const int      iEta   = twr -> getTowerEtaBin(keyTwr);
+        const int      iPhi   = twr -> getTowerPhiBin(keyTwr);
+
+        // get corresponding raw tower key & geometry
+        const int keyRaw = (int) RawTowerDefs::encode_towerid(
+          (RawTowerDefs::CalorimeterId) Const::IndexOntoID(sys),
+          iEta,
+          iPhi
+        );
+        const RawTowerGeom* geometry = geo -> get_tower_geometry(keyRaw);
+        Add((int) keyTwr, iEta, iPhi, keyRaw, geometry);
+      }
+
+    } else {
+
+      RawTowerGeomContainer::ConstRange range = geo -> get_tower_geometries();
+      for (
+        RawTowerGeomContainer::ConstIterator itGeo = range.first;
+        itGeo != range.second;
+        ++itGeo
+      ) {
+        const RawTowerGeom* geometry = itGeo -> second;
+        const int           keyRaw   = (int) itGeo -> first;
+        Add(
+          keyRaw,
+          geometry -> get_bineta(),
+          geometry -> get_binphi(),
+          keyRaw,
+          geometry
+        );
+      }
+    }
+    return;
+
+  }  // end 'Build(int, RawTowerGeomContainer*, TowerInfoContainer*)'
+
+
+
+  // tower geometry interfaces ================================================
+
+  // --------------------------------------------------------------------------
+  //! Get geometry table for a subsystem, building it if needed
+  // --------------------------------------------------------------------------
+  /*! Tables persist across events and are only
+   *  rebuilt when the geometry container changes
+   *  (e.g. at a new run), or when channel ordering
+   *  is requested but the table doesn't have it.
+   *
+   *  Towers without a geometry are a PANIC unless
+   *  allowMissing is set, in which case they're
+   *  left with NaN positions for the caller to
+   *  skip.
+   */
+  const Interfaces::TwrGeoTable& Interfaces::GetTwrGeoTable(
+    const int sys,
+    EventContext& context,
+    const bool byChannel,
+    const bool allowMissing
+  ) {
+
+    array<TwrGeoTable, Const::Subsys::OHCal + 1>& tables = GetTwrGeoTables();
+    if ((sys < Const::Subsys::EMCal) || (sys > Const::Subsys::OHCal)) {
+      cerr << PHWHERE
+           << "PANIC: no tower geometry for subsystem " << sys << "!"
+           << endl;
+      assert((sys >= Const::Subsys::EMCal) && (sys <= Const::Subsys::OHCal));
+    }
+
+    // grab containers
+    RawTowerGeomContainer* geometries = context.GetTowerGeometries( Const::IndexOntoTowerGeom(sys) );
+    TowerInfoContainer*    towers     = byChannel
+                                      ? context.GetTowerInfoStore( Const::IndexOntoTowerInfo(sys) )
+                                      : nullptr;
+
+    // (re)build if needed
+    TwrGeoTable& table = tables[sys];
+    if (!table.IsCurrent(geometries, towers)) {
+      table.Build(sys, geometries, towers);
+    }
+
+    // check for towers without a geometry
+    if (!allowMissing && (table.GetNMissing() > 0)) {
+      cerr << PHWHERE
+           << "PANIC: geometry is missing for " << table.GetNMissing() << " towers from node " << Const::IndexOntoTowerGeom(sys) << "!"
+           << endl;
+      assert(allowMissing || (table.GetNMissing() == 0));
+    }
+    return table;
+
+  }  // end 'GetTwrGeoTable(int, EventContext&, bool, bool)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get (per-thread) geometry tables for all subsystems
+  // --------------------------------------------------------------------------
+  array<Interfaces::TwrGeoTable, Const::Subsys::OHCal + 1>& Interfaces::GetTwrGeoTables() {
+
+    thread_local array<TwrGeoTable, Const::Subsys::OHCal + 1> tables;
+    return tables;
+
+  }  // end 'GetTwrGeoTables()'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Clear geometry tables for all subsystems
+  // --------------------------------------------------------------------------
+  void Interfaces::ResetTwrGeoTables() {
+
+    for (TwrGeoTable& table : GetTwrGeoTables()) {
+      table.Reset();
+    }
+    return;
+
+  }  // end 'ResetTwrGeoTables()'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,122 @@
+/// ---------------------------------------------------------------------------
+/*! \file   TwrGeoTable.h
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Per-run cache of calorimeter tower geometry.
+ */
+/// ---------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TWRGEOTABLE_H
+#define SCORRELATORUTILITIES_TWRGEOTABLE_H
+
+// c++ utilities
+#include <cmath>
+#include <array>
+#include <limits>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+// phool libraries
+#include <phool/phool.h>
+// calobase libraries
+#include <calobase/RawTowerGeom.h>
+#include <calobase/RawTowerDefs.h>
+#include <calobase/TowerInfoContainer.h>
+#include <calobase/RawTowerGeomContainer.h>
+// analysis utilities
+#include "Constants.h"
+#include "EventContext.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Interfaces {
+
+    // ------------------------------------------------------------------------
+    //! Dense tower geometry table for one subsystem
+    // ------------------------------------------------------------------------
+    /*! Holds tower geometry as structure-of-arrays
+     *  columns. When built from a TowerInfo
+     *  container, entry i corresponds to channel i;
+     *  otherwise entries follow the order of the
+     *  geometry container. A tower without a
+     *  geometry gets NaN positions. Unless the
+     *  caller asks to allow missing geometries
+     *  (and skips NaN entries itself), such a
+     *  table is a PANIC.
+     */
+    class TwrGeoTable {
+
+      private:
+
+        // container the table was built from
+        const RawTowerGeomContainer* geometries = nullptr;
+        bool                         byChannel  = false;
+        size_t                       nMissing   = 0;
+
+        // raw tower key onto entry
+        unordered_map<int, uint32_t> rawKeyOntoEntry;
+
+      public:
+
+        // columns
+        vector<int>   towerKey;
+        vector<int>   etaBin;
+        vector<int>   phiBin;
+        vector<int>   rawKey;
+        vector<float> x;
+        vector<float> y;
+        vector<float> z;
+        vector<float> radius;
+        vector<float> phi;
+
+        // getters
+        size_t GetSize()     const {return rawKey.size();}
+        size_t GetNMissing() const {return nMissing;}
+        bool   IsByChannel() const {return byChannel;}
+
+        // public methods
+        bool IsCurrent(const RawTowerGeomContainer* geo, const TowerInfoContainer* twr) const {
+          const bool isSameGeo = (geo == geometries) && !rawKey.empty();
+          const bool isSameTwr = (twr == nullptr) || (byChannel && (twr -> size() == rawKey.size()));
+          return (isSameGeo && isSameTwr);
+        }
+        uint32_t GetEntry(const int key) const {
+          auto itEntry = rawKeyOntoEntry.find(key);
+          if (itEntry == rawKeyOntoEntry.end()) {
+            cerr << PHWHERE
+                 << "PANIC: geometry is missing for key " << key << "!"
+                 << endl;
+            assert(itEntry != rawKeyOntoEntry.end());
+          }
+          return itEntry -> second;
+        }
+        void Reset();
+        void Build(const int sys, RawTowerGeomContainer* geo, TowerInfoContainer* twr = nullptr);
+
+      private:
+
+        // private methods
+        void Add(const int keyTwr, const int iEta, const int iPhi, const int keyRaw, const RawTowerGeom* geometry);
+
+    };  // end TwrGeoTable def
+
+
+
+    // tower geometry interfaces ----------------------------------------------
+
+    const TwrGeoTable&                            GetTwrGeoTable(const int sys, EventContext& context, const bool byChannel = true, const bool allowMissing = false);
+    array<TwrGeoTable, Const::Subsys::OHCal + 1>& GetTwrGeoTables();
+    void                                          ResetTwrGeoTables();
+
+  }  // end Interfaces namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
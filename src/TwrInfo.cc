@@ -96,6 +96,24 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<ROOT::Math::XYZVector> vtx
   ) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(sys, tower, context, vtx);
+    return;
+
+  }  // end 'SetInfo(int, RawTower*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A RawTower using an event context
+  // --------------------------------------------------------------------------
+  void Types::TwrInfo::SetInfo(
+    const int sys,
+    const RawTower* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
     // if no vertex provided, use origin
     ROOT::Math::XYZVector vtxToUse(0., 0., 0.);
     if (vtx.has_value()) {
@@ -109,7 +127,7 @@ namespace SColdQcdCorrelatorAnalysis {
     ROOT::Math::XYZVector xyzPos = Tools::GetTowerPositionXYZ(
       rawKey,
       sys,
-      topNode
+      context
     );
 
     // grab position in (rho, eta, phi)
@@ -117,7 +135,7 @@ namespace SColdQcdCorrelatorAnalysis {
       rawKey,
       sys,
       vtxToUse.z(),
-      topNode
+      context
     );
 
     // grab momentum
@@ -142,7 +160,7 @@ namespace SColdQcdCorrelatorAnalysis {
     rz      = xyzPos.z();
     return;
 
-  }  // end 'SetInfo(int, RawTower*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+  }  // end 'SetInfo(int, RawTower*, EventContext&, optional<ROOT::Math::XYZVector>)'
 
 
 
@@ -157,29 +175,42 @@ namespace SColdQcdCorrelatorAnalysis {
     optional<ROOT::Math::XYZVector> vtx
   ) {
 
+    Interfaces::EventContext context(topNode);
+    SetInfo(sys, chan, tower, context, vtx);
+    return;
+
+  }  // end 'SetInfo(int, int, TowerInfo*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Pull relevant information from a F4A TowerInfo using an event context
+  // --------------------------------------------------------------------------
+  void Types::TwrInfo::SetInfo(
+    const int sys,
+    const int chan,
+    TowerInfo* tower,
+    Interfaces::EventContext& context, 
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
     // if no vertex provided, use origin
     ROOT::Math::XYZVector vtxToUse(0., 0., 0.);
     if (vtx.has_value()) {
       vtxToUse = vtx.value();
     }
 
-    // get raw tower key 
-    const auto indices = Tools::GetTowerIndices(chan, sys, topNode);
-    const int  rawKey  = Tools::GetRawTowerKey(Const::MapIndexOntoID()[ sys ], indices);
+    // grab cached geometry, indexed by channel
+    const Interfaces::TwrGeoTable& table = Interfaces::GetTwrGeoTable(sys, context);
 
     // grab position in (x, y, z)
-    ROOT::Math::XYZVector xyzPos = Tools::GetTowerPositionXYZ(
-      rawKey,
-      sys,
-      topNode
-    );
+    ROOT::Math::XYZVector xyzPos = Tools::GetTowerPositionXYZ(table, chan);
 
     // grab position in (rho, eta, phi)
     ROOT::Math::RhoEtaPhiVector rhfPos = Tools::GetTowerPositionRhoEtaPhi(
-      rawKey,
-      sys,
-      vtxToUse.z(),
-      topNode
+      table,
+      chan,
+      vtxToUse.z()
     );
 
     // grab momentum
@@ -192,7 +223,7 @@ namespace SColdQcdCorrelatorAnalysis {
     system  = sys;
     status  = Tools::GetTowerStatus(tower);
     channel = chan;
-    id      = get<0>(indices);
+    id      = table.towerKey[chan];
     ene     = tower -> get_energy();
     rho     = rhfPos.Rho();
     eta     = rhfPos.Eta();
@@ -205,7 +236,7 @@ namespace SColdQcdCorrelatorAnalysis {
     rz      = xyzPos.z();
     return;
 
-  }  // end 'SetInfo(int, int, TowerInfo*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
+  }  // end 'SetInfo(int, int, TowerInfo*, EventContext&, optional<ROOT::Math::XYZVector>)'
 
 
 
@@ -245,6 +276,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Map infinities from single-precision storage back onto double limits
+  // --------------------------------------------------------------------------
+  void Types::TwrInfo::RestoreLimits() {
+
+    for (double* member : {&ene, &rho, &eta, &phi, &px, &py, &pz, &rx, &ry, &rz}) {
+      if (isinf(*member)) {
+        *member = copysign(numeric_limits<double>::max(), *member);
+      }
+    }
+    return;
+
+  }  // end 'RestoreLimits()'
+
+
+
   // static methods ===========================================================
 
   // --------------------------------------------------------------------------
@@ -433,6 +480,22 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A RawTower and an event context
+  // --------------------------------------------------------------------------
+  Types::TwrInfo::TwrInfo(
+    const int sys,
+    const RawTower* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
+    SetInfo(sys, tower, context, vtx);
+
+  }  // end ctor(int, RawTower*, EventContext&, optional<ROOT::Math::XYZVector>)'
+
+
+
   // --------------------------------------------------------------------------
   //! Constructor accepting a F4A TowerInfo
   // --------------------------------------------------------------------------
@@ -448,6 +511,23 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(int, int, TowerInfo*, PHCompositeNode*, optional<ROOT::Math::XYZVector>)'
 
+
+
+  // --------------------------------------------------------------------------
+  //! Constructor accepting a F4A TowerInfo and an event context
+  // --------------------------------------------------------------------------
+  Types::TwrInfo::TwrInfo(
+    const int sys,
+    const int chan,
+    TowerInfo* tower,
+    Interfaces::EventContext& context,
+    optional<ROOT::Math::XYZVector> vtx
+  ) {
+
+    SetInfo(sys, chan, tower, context, vtx);
+
+  }  // end ctor(int, int, TowerInfo*, EventContext&, optional<ROOT::Math::XYZVector>)'
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
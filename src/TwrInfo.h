@@ -12,6 +12,7 @@
 #define SCORRELATORUTILITIES_TWRINFO_H
 
 // c++ utilities
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
@@ -51,20 +52,20 @@ namespace SColdQcdCorrelatorAnalysis {
       private:
 
         // data members
-        int     system  = numeric_limits<int>::max();
-        int     status  = numeric_limits<int>::max();
-        int     channel = numeric_limits<int>::max();
-        int     id      = numeric_limits<int>::max();
-        double  ene     = numeric_limits<double>::max();
-        double  rho     = numeric_limits<double>::max();
-        double  eta     = numeric_limits<double>::max();
-        double  phi     = numeric_limits<double>::max();
-        double  px      = numeric_limits<double>::max();
-        double  py      = numeric_limits<double>::max();
-        double  pz      = numeric_limits<double>::max();
-        double  rx      = numeric_limits<double>::max();
-        double  ry      = numeric_limits<double>::max();
-        double  rz      = numeric_limits<double>::max();
+        int        system  = numeric_limits<int>::max();
+        int        status  = numeric_limits<int>::max();
+        int        channel = numeric_limits<int>::max();
+        int        id      = numeric_limits<int>::max();
+        Double32_t ene     = numeric_limits<double>::max();
+        Double32_t rho     = numeric_limits<double>::max();
+        Double32_t eta     = numeric_limits<double>::max();
+        Double32_t phi     = numeric_limits<double>::max();
+        Double32_t px      = numeric_limits<double>::max();
+        Double32_t py      = numeric_limits<double>::max();
+        Double32_t pz      = numeric_limits<double>::max();
+        Double32_t rx      = numeric_limits<double>::max();
+        Double32_t ry      = numeric_limits<double>::max();
+        Double32_t rz      = numeric_limits<double>::max();
 
         // private methods
         void Minimize();
@@ -107,9 +108,12 @@ namespace SColdQcdCorrelatorAnalysis {
         // public methods
         void Reset();
         void SetInfo(const int sys, const RawTower* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        void SetInfo(const int sys, const RawTower* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         void SetInfo(const int sys, const int chan, TowerInfo* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        void SetInfo(const int sys, const int chan, TowerInfo* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         bool IsInAcceptance(const TwrInfo& minimum, const TwrInfo& maximum) const;
         bool IsInAcceptance(const pair<TwrInfo, TwrInfo>& range) const;
+        void RestoreLimits();
         bool IsGood() const;
 
         // static methods
@@ -128,10 +132,12 @@ namespace SColdQcdCorrelatorAnalysis {
         // ctors accepting arguments
         TwrInfo(const Const::Init init);
         TwrInfo(const int sys, const RawTower* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        TwrInfo(const int sys, const RawTower* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
         TwrInfo(const int sys, const int chan, TowerInfo* tower, PHCompositeNode* topNode, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        TwrInfo(const int sys, const int chan, TowerInfo* tower, Interfaces::EventContext& context, optional<ROOT::Math::XYZVector> vtx = nullopt);
 
       // identify this class to ROOT
-      ClassDefNV(TwrInfo, 1)
+      ClassDefNV(TwrInfo, 2)
 
     };  // end TwrInfo def
 
@@ -100,20 +100,30 @@ namespace SColdQcdCorrelatorAnalysis {
     // grab geometry container
     RawTowerGeomContainer* geometries = GetTowerGeometries( 
       topNode,
-      Const::MapIndexOntoTowerGeom()[ subsys ]
+      string( Const::IndexOntoTowerGeom(subsys) )
     );
+    return GetTowerGeometry(geometries, subsys, rawKey);
 
-    // now grab geometry associated with RawTower key
+  }  // end 'GetTowerGeometry(PHCompositeNode*, int, int)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific tower geometry from a provided container
+  // --------------------------------------------------------------------------
+  RawTowerGeom* Interfaces::GetTowerGeometry(RawTowerGeomContainer* geometries, const int subsys, const int rawKey) {
+
+    // grab geometry associated with RawTower key
     RawTowerGeom* geometry = geometries -> get_tower_geometry(rawKey);
     if (!geometry) {
       cout << PHWHERE
-           << "PANIC: geometry is missing for key " << rawKey << " from node " << Const::MapIndexOntoTowerGeom()[ subsys ] << "!"
+           << "PANIC: geometry is missing for key " << rawKey << " from node " << Const::IndexOntoTowerGeom(subsys) << "!"
            << endl;
       assert(geometry);
     }
     return geometry;
 
-  }  // end 'GetTowerGeometry(PHCompositeNode*, int, int)'
+  }  // end 'GetTowerGeometry(RawTowerGeomContainer*, int, int)'
 
 }  // end SColdQcdCorrealtorAnalysis namespace
 
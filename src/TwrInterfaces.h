@@ -46,7 +46,8 @@ namespace SColdQcdCorrelatorAnalysis {
     TowerInfoContainer*           GetTowerInfoStore(PHCompositeNode* topNode, const string node);
     RawTowerContainer::ConstRange GetRawTowers(PHCompositeNode* topNode, const string store);
     RawTowerGeomContainer*        GetTowerGeometries(PHCompositeNode* topNode, const string node);
-    RawTowerGeom*                 GetTowerGeometry(PHCompositeNode* topNode, const int subsys, const int rawKey); 
+    RawTowerGeom*                 GetTowerGeometry(PHCompositeNode* topNode, const int subsys, const int rawKey);
+    RawTowerGeom*                 GetTowerGeometry(RawTowerGeomContainer* geometries, const int subsys, const int rawKey);
 
   }  // end Interfaces namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
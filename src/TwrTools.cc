@@ -86,19 +86,32 @@ namespace SColdQcdCorrelatorAnalysis {
     PHCompositeNode* topNode
   ) {
 
-    // grab container & key
-    TowerInfoContainer* towers = Interfaces::GetTowerInfoStore(
-      topNode,
-      Const::MapIndexOntoTowerInfo()[ subsys ]
-    );
-    const uint32_t key = towers -> encode_key(channel);
+    Interfaces::EventContext context(topNode);
+    return GetTowerIndices(channel, subsys, context);
+
+  }  // end 'GetTowerIndices(int, int, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get key and eta-phi indices for a TowerInfo object using an event context
+  // --------------------------------------------------------------------------
+  tuple<int, int, int> Tools::GetTowerIndices(
+    const int channel,
+    const int subsys,
+    Interfaces::EventContext& context
+  ) {
+
+    // grab (cached) container & key
+    TowerInfoContainer* towers = context.GetTowerInfoStore( Const::IndexOntoTowerInfo(subsys) );
+    const uint32_t      key    = towers -> encode_key(channel);
 
     // grab indices
     const int iEta = towers -> getTowerEtaBin(key);
     const int iPhi = towers -> getTowerPhiBin(key);
     return make_tuple((int) key, iEta, iPhi);
 
-  }  // end 'GetTowerIndices(int, int, PHCompositeNode*)'
+  }  // end 'GetTowerIndices(int, int, EventContext&)'
 
 
 
@@ -107,21 +120,26 @@ namespace SColdQcdCorrelatorAnalysis {
   // --------------------------------------------------------------------------
   ROOT::Math::XYZVector Tools::GetTowerPositionXYZ(const int rawKey, const int subsys, PHCompositeNode* topNode) {
 
-    // get corresponding geometry
-    RawTowerGeom* geometry = Interfaces::GetTowerGeometry(topNode, subsys, rawKey);
-
-    // grab (x, y, z) coordinates
-    ROOT::Math::XYZVector position(
-      geometry -> get_center_x(),
-      geometry -> get_center_y(),
-      geometry -> get_center_z()
-    );
-    return position;
+    Interfaces::EventContext context(topNode);
+    return GetTowerPositionXYZ(rawKey, subsys, context);
 
   }  // end 'GetTowerPositionXYZ(int, int, PHCompositeNode*)'
 
 
 
+  // --------------------------------------------------------------------------
+  //! Get tower coordinates in (x, y, z) using an event context
+  // --------------------------------------------------------------------------
+  ROOT::Math::XYZVector Tools::GetTowerPositionXYZ(const int rawKey, const int subsys, Interfaces::EventContext& context) {
+
+    // look up tower in cached geometry table
+    const Interfaces::TwrGeoTable& table = Interfaces::GetTwrGeoTable(subsys, context, false);
+    return GetTowerPositionXYZ(table, table.GetEntry(rawKey));
+
+  }  // end 'GetTowerPositionXYZ(int, int, EventContext&)'
+
+
+
   // --------------------------------------------------------------------------
   //! Get tower coordinates in (r, eta, phi)
   // --------------------------------------------------------------------------
@@ -132,24 +150,70 @@ namespace SColdQcdCorrelatorAnalysis {
     PHCompositeNode* topNode
   ) {
 
-    // get corresponding geometry
-    RawTowerGeom* geometry = Interfaces::GetTowerGeometry(topNode, subsys, rawKey);
+    Interfaces::EventContext context(topNode);
+    return GetTowerPositionRhoEtaPhi(rawKey, subsys, zVtx, context);
+
+  }  // end 'GetTowerPositionRhoEtaPhi(int, int, float, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get tower coordinates in (r, eta, phi) using an event context
+  // --------------------------------------------------------------------------
+  ROOT::Math::RhoEtaPhiVector Tools::GetTowerPositionRhoEtaPhi(
+    const int rawKey,
+    const int subsys,
+    const float zVtx,
+    Interfaces::EventContext& context
+  ) {
+
+    // look up tower in cached geometry table
+    const Interfaces::TwrGeoTable& table = Interfaces::GetTwrGeoTable(subsys, context, false);
+    return GetTowerPositionRhoEtaPhi(table, table.GetEntry(rawKey), zVtx);
+
+  }  // end 'GetTowerPositionRhoEtaPhi(int, int, float, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get tower coordinates in (x, y, z) from a geometry table
+  // --------------------------------------------------------------------------
+  ROOT::Math::XYZVector Tools::GetTowerPositionXYZ(const Interfaces::TwrGeoTable& table, const size_t entry) {
+
+    ROOT::Math::XYZVector position(
+      table.x[entry],
+      table.y[entry],
+      table.z[entry]
+    );
+    return position;
+
+  }  // end 'GetTowerPositionXYZ(Interfaces::TwrGeoTable&, size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get tower coordinates in (r, eta, phi) from a geometry table
+  // --------------------------------------------------------------------------
+  ROOT::Math::RhoEtaPhiVector Tools::GetTowerPositionRhoEtaPhi(
+    const Interfaces::TwrGeoTable& table,
+    const size_t entry,
+    const float zVtx
+  ) {
 
     // calculate variables
-    const float zShift = (geometry -> get_center_z()) - zVtx;
-    const float radius = geometry -> get_center_radius();
+    const float zShift = table.z[entry] - zVtx;
+    const float radius = table.radius[entry];
     const float eta    = asinh(zShift / radius);
-    const float phi    = atan2(geometry -> get_center_y(), geometry -> get_center_x());
 
     // grab (rho, eta, phi) coordinates
     ROOT::Math::RhoEtaPhiVector position(
       radius,
       eta,
-      phi
+      table.phi[entry]
     );
     return position;
 
-  }  // end 'GetTowerPositionRhoEtaPhi(int, int, float, PHCompositeNode*)'
+  }  // end 'GetTowerPositionRhoEtaPhi(Interfaces::TwrGeoTable&, size_t, float)'
 
 
 
@@ -174,6 +238,113 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end 'GetTowerMomentum(double, ROOT::Math::XYZVector, ROOT::Math::XYZVector)'
 
+
+
+  // --------------------------------------------------------------------------
+  //! Get kinematics of every tower in a subsystem
+  // --------------------------------------------------------------------------
+  Tools::TwrKinematics Tools::GetTowerKinematics(const int subsys, const float zVtx, PHCompositeNode* topNode) {
+
+    Interfaces::EventContext context(topNode);
+    return GetTowerKinematics(subsys, zVtx, context);
+
+  }  // end 'GetTowerKinematics(int, float, PHCompositeNode*)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get kinematics of every tower in a subsystem using an event context
+  // --------------------------------------------------------------------------
+  Tools::TwrKinematics Tools::GetTowerKinematics(const int subsys, const float zVtx, Interfaces::EventContext& context) {
+
+    TwrKinematics kinematics;
+    GetTowerKinematics(
+      Interfaces::GetTwrGeoTable(subsys, context),
+      context.GetTowerInfoStore( Const::IndexOntoTowerInfo(subsys) ),
+      zVtx,
+      kinematics
+    );
+    return kinematics;
+
+  }  // end 'GetTowerKinematics(int, float, EventContext&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Fill kinematics of every tower in a container
+  // --------------------------------------------------------------------------
+  /*! Table must be ordered by channel (see
+   *  Interfaces::GetTwrGeoTable). Provided
+   *  columns are resized to the number of
+   *  channels; their capacity is kept, so
+   *  they can be reused between events.
+   *
+   *  The momentum loop only touches contiguous
+   *  float arrays and avoids the per-tower
+   *  trigonometry of GetTowerMomentum: with
+   *  u = (z - zVtx) / r, we have eta = asinh(u)
+   *  (as in GetTowerPositionRhoEtaPhi),
+   *  cosh(eta) = sqrt(1 + u^2), and cos(phi),
+   *  sin(phi) follow from (x, y) directly.
+   */
+  void Tools::GetTowerKinematics(
+    const Interfaces::TwrGeoTable& table,
+    TowerInfoContainer* towers,
+    const float zVtx,
+    TwrKinematics& kinematics
+  ) {
+
+    const size_t nChan = towers -> size();
+    if (!table.IsByChannel() || (table.GetSize() != nChan)) {
+      cerr << PHWHERE
+           << "PANIC: geometry table doesn't match tower container!"
+           << endl;
+      assert(table.IsByChannel() && (table.GetSize() == nChan));
+    }
+    kinematics.Resize(nChan);
+
+    // gather energies & statuses (missing towers are empty)
+    for (size_t iChan = 0; iChan < nChan; ++iChan) {
+      TowerInfo* tower = towers -> get_tower_at_channel(iChan);
+      if (!tower) {
+        kinematics.energy[iChan] = 0.;
+        kinematics.status[iChan] = Const::TowerStatus::NA;
+        continue;
+      }
+      kinematics.energy[iChan] = tower -> get_energy();
+      kinematics.status[iChan] = GetTowerStatus(tower);
+    }
+
+    // grab raw column pointers so the loop below vectorizes
+    const float* x      = table.x.data();
+    const float* y      = table.y.data();
+    const float* z      = table.z.data();
+    const float* radius = table.radius.data();
+    const float* energy = kinematics.energy.data();
+    float*       eta    = kinematics.eta.data();
+    float*       px     = kinematics.px.data();
+    float*       py     = kinematics.py.data();
+    float*       pz     = kinematics.pz.data();
+
+    // calculate momenta
+    for (size_t iChan = 0; iChan < nChan; ++iChan) {
+      const float u     = (z[iChan] - zVtx) / radius[iChan];
+      const float coshH = sqrt(1.f + (u * u));
+      const float pt    = energy[iChan] / coshH;
+      const float rxy   = sqrt((x[iChan] * x[iChan]) + (y[iChan] * y[iChan]));
+      eta[iChan] = asinh(u);
+      px[iChan]  = pt * (x[iChan] / rxy);
+      py[iChan]  = pt * (y[iChan] / rxy);
+      pz[iChan]  = pt * u;
+    }
+
+    // phi doesn't depend on vertex
+    copy(table.phi.begin(), table.phi.end(), kinematics.phi.begin());
+    return;
+
+  }  // end 'GetTowerKinematics(Interfaces::TwrGeoTable&, TowerInfoContainer*, float, TwrKinematics&)'
+
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -13,7 +13,10 @@
 
 // c++ utilities
 #include <cmath>
+#include <vector>
+#include <cassert>
 #include <utility>
+#include <algorithm>
 // root libraries
 #include <Math/Vector3D.h>
 #include <Math/Vector4D.h>
@@ -37,16 +40,53 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // ------------------------------------------------------------------------
+    //! Kinematics of every tower in a subsystem
+    // ------------------------------------------------------------------------
+    /*! Structure-of-arrays columns filled by
+     *  GetTowerKinematics. Entry i corresponds
+     *  to channel i of the TowerInfo container.
+     */
+    struct TwrKinematics {
+      vector<float> energy;
+      vector<float> eta;
+      vector<float> phi;
+      vector<float> px;
+      vector<float> py;
+      vector<float> pz;
+      vector<int>   status;
+      size_t GetSize() const {return energy.size();}
+      void   Resize(const size_t size) {
+        energy.resize(size);
+        eta.resize(size);
+        phi.resize(size);
+        px.resize(size);
+        py.resize(size);
+        pz.resize(size);
+        status.resize(size);
+      }
+    };
+
     // tower methods ----------------------------------------------------------
 
     int                         GetTowerStatus(const TowerInfo* tower);
     int                         GetCaloIDFromRawTower(RawTower* tower);
     int                         GetRawTowerKey(const int idGeo, const tuple<int, int, int> indices);
     tuple<int, int, int>        GetTowerIndices(const int channel, const int subsys, PHCompositeNode* topNode);
+    tuple<int, int, int>        GetTowerIndices(const int channel, const int subsys, Interfaces::EventContext& context);
     ROOT::Math::XYZVector       GetTowerPositionXYZ(const int rawKey, const int subsys, PHCompositeNode* topNode);
+    ROOT::Math::XYZVector       GetTowerPositionXYZ(const int rawKey, const int subsys, Interfaces::EventContext& context);
     ROOT::Math::RhoEtaPhiVector GetTowerPositionRhoEtaPhi(const int rawKey, const int subsys, const float zVtx, PHCompositeNode* topNode);
+    ROOT::Math::RhoEtaPhiVector GetTowerPositionRhoEtaPhi(const int rawKey, const int subsys, const float zVtx, Interfaces::EventContext& context);
+    ROOT::Math::XYZVector       GetTowerPositionXYZ(const Interfaces::TwrGeoTable& table, const size_t entry);
+    ROOT::Math::RhoEtaPhiVector GetTowerPositionRhoEtaPhi(const Interfaces::TwrGeoTable& table, const size_t entry, const float zVtx);
     ROOT::Math::PxPyPzEVector   GetTowerMomentum(const double energy, const ROOT::Math::RhoEtaPhiVector pos);
 
+    // bulk tower methods
+    TwrKinematics GetTowerKinematics(const int subsys, const float zVtx, PHCompositeNode* topNode);
+    TwrKinematics GetTowerKinematics(const int subsys, const float zVtx, Interfaces::EventContext& context);
+    void          GetTowerKinematics(const Interfaces::TwrGeoTable& table, TowerInfoContainer* towers, const float zVtx, TwrKinematics& kinematics);
+
   }  // end Tools namespace
 }  // end SColdQcdCorrelatorAnalysis namespace
 
@@ -10,14 +10,28 @@
 #ifndef SCORRELATORUTILITIES_TYPES_H
 #define SCORRELATORUTILITIES_TYPES_H
 
+#include "BootstrapWeights.h"
+#include "ClustColumns.h"
 #include "ClustInfo.h"
+#include "CstColumns.h"
 #include "CstInfo.h"
+#include "Cut.h"
+#include "EECEngine.h"
+#include "ENCEngine.h"
+#include "FlowColumns.h"
 #include "FlowInfo.h"
 #include "GEvtInfo.h"
+#include "HistAccumulator.h"
+#include "JetColumns.h"
 #include "JetInfo.h"
+#include "ParColumns.h"
 #include "ParInfo.h"
 #include "REvtInfo.h"
+#include "SigmaDcaModel.h"
+#include "TrackTruthMatchTable.h"
+#include "TrkColumns.h"
 #include "TrkInfo.h"
+#include "TwrColumns.h"
 #include "TwrInfo.h"
 
 #endif
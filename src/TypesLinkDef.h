@@ -12,14 +12,21 @@
 #include <vector>
 #include <utility>
 // analysis types
+#include "ClustColumns.h"
 #include "ClustInfo.h"
+#include "CstColumns.h"
 #include "CstInfo.h"
+#include "FlowColumns.h"
 #include "FlowInfo.h"
 #include "GEvtInfo.h"
+#include "JetColumns.h"
 #include "JetInfo.h"
+#include "ParColumns.h"
 #include "ParInfo.h"
 #include "REvtInfo.h"
+#include "TrkColumns.h"
 #include "TrkInfo.h"
+#include "TwrColumns.h"
 #include "TwrInfo.h"
 
 #ifdef __CINT__
@@ -49,6 +56,44 @@
 #pragma link C++ class std::vector<std::vector<ParInfo> >+;
 #pragma link C++ class std::pair<ParInfo, ParInfo>+;
 
+// kinematics are written as Double32_t (float on disk) since version 2,
+// where the double limits used to minimize/maximize members overflow to
+// +-inf: map them back after reading. Version 1 files are read as-is.
+#pragma read sourceClass="ClustInfo" targetClass="ClustInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="CstInfo" targetClass="CstInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="FlowInfo" targetClass="FlowInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="JetInfo" targetClass="JetInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="ParInfo" targetClass="ParInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="TrkInfo" targetClass="TrkInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="TwrInfo" targetClass="TwrInfo" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+
+// column-wise (SoA) utility types
+#pragma link C++ class ClustColumns+;
+#pragma link C++ class CstColumns+;
+#pragma link C++ class FlowColumns+;
+#pragma link C++ class JetColumns+;
+#pragma link C++ class ParColumns+;
+#pragma link C++ class TrkColumns+;
+#pragma link C++ class TwrColumns+;
+
+// kinematic columns are likewise written as Double32_t since version 2
+#pragma read sourceClass="ClustColumns" targetClass="ClustColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="CstColumns" targetClass="CstColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="FlowColumns" targetClass="FlowColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="JetColumns" targetClass="JetColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="ParColumns" targetClass="ParColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="TrkColumns" targetClass="TrkColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+#pragma read sourceClass="TwrColumns" targetClass="TwrColumns" version="[2-]" source="" target="" code="{ newObj -> RestoreLimits(); }"
+
+// stl collections of column-wise utility types
+#pragma link C++ class std::vector<ClustColumns>+;
+#pragma link C++ class std::vector<CstColumns>+;
+#pragma link C++ class std::vector<FlowColumns>+;
+#pragma link C++ class std::vector<JetColumns>+;
+#pragma link C++ class std::vector<ParColumns>+;
+#pragma link C++ class std::vector<TrkColumns>+;
+#pragma link C++ class std::vector<TwrColumns>+;
+
 #endif
 
 // end ------------------------------------------------------------------------
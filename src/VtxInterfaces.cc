@@ -53,8 +53,16 @@ namespace SColdQcdCorrelatorAnalysis {
    */ 
   GlobalVertex* Interfaces::GetGlobalVertex(PHCompositeNode* topNode, optional<int> iVtxToGrab) {
 
-    // get vertex map
-    GlobalVertexMap* mapVtx = GetVertexMap(topNode);
+    return GetGlobalVertex(GetVertexMap(topNode), iVtxToGrab);
+
+  }  // end 'GetGlobalVertex(PHCompositeNode*, optional<int>)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Get a specific vertex from a provided vertex map
+  // -------------------------------------------------------------------------
+  GlobalVertex* Interfaces::GetGlobalVertex(GlobalVertexMap* mapVtx, optional<int> iVtxToGrab) {
 
     // get specified vertex
     GlobalVertex* vtx = NULL;
@@ -73,7 +81,7 @@ namespace SColdQcdCorrelatorAnalysis {
     }
     return vtx;
 
-  }  // end 'GetGlobalVertex(PHCompositeNode*, optional<int>)'
+  }  // end 'GetGlobalVertex(GlobalVertexMap*, optional<int>)'
 
 
 
@@ -39,6 +39,7 @@ namespace SColdQcdCorrelatorAnalysis {
 
     GlobalVertexMap*      GetVertexMap(PHCompositeNode* topNode);
     GlobalVertex*         GetGlobalVertex(PHCompositeNode* topNode, optional<int> iVtxToGrab = nullopt);
+    GlobalVertex*         GetGlobalVertex(GlobalVertexMap* mapVtx, optional<int> iVtxToGrab = nullopt);
     ROOT::Math::XYZVector GetRecoVtx(PHCompositeNode* topNode);
 
   }  // end Interfaces namespace
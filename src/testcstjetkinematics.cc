@@ -0,0 +1,189 @@
+/// ---------------------------------------------------------------------------
+/*! \file   testcstjetkinematics.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Checks that the scalar and batch paths for
+ *  jet-relative constituent kinematics (z, dR, jT)
+ *  agree with the original XYZVector-based formula.
+ */
+/// ---------------------------------------------------------------------------
+
+// c++ utilities
+#include <cmath>
+#include <vector>
+#include <iostream>
+// root libraries
+#include <Math/Vector3D.h>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "CstColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace SColdQcdCorrelatorAnalysis;
+
+
+
+namespace {
+
+  // tolerance on relative differences
+  const double tolerance = 1e-12;
+
+
+
+  // --------------------------------------------------------------------------
+  //! Reference z, dR, jT using the original per-constituent formula
+  // --------------------------------------------------------------------------
+  /*! Identical to the pre-batch SetJetInfo,
+   *  except dPhi is wrapped into [-pi, pi].
+   */
+  void GetReference(
+    const Types::JetInfo& jet,
+    const Types::CstInfo& cst,
+    double& z,
+    double& dr,
+    double& jt
+  ) {
+
+    // grab 3-momenta
+    ROOT::Math::XYZVector pJet(jet.GetPX(), jet.GetPY(), jet.GetPZ());
+    ROOT::Math::XYZVector pCst(cst.GetPX(), cst.GetPY(), cst.GetPZ());
+    ROOT::Math::XYZVector pCross = pCst.Cross(pJet);
+
+    // get delta eta/phi
+    const double dEta = cst.GetEta() - jet.GetEta();
+    const double dPhi = remainder(cst.GetPhi() - jet.GetPhi(), 2. * M_PI);
+
+    z  = pCst.Dot(pJet) / pJet.Mag2();
+    dr = sqrt((dEta * dEta) + (dPhi * dPhi));
+    jt = sqrt( pCross.Mag2() ) / pJet.Mag2();
+    return;
+
+  }  // end 'GetReference(Types::JetInfo&, Types::CstInfo&, double&, double&, double&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check that a value agrees with its reference
+  // --------------------------------------------------------------------------
+  bool IsClose(const double value, const double reference, const string& what, const size_t iCst) {
+
+    const double scale   = max(1., abs(reference));
+    const bool   isClose = (abs(value - reference) <= (tolerance * scale));
+    if (!isClose) {
+      cerr << "FAIL: " << what << " of constituent " << iCst
+           << " = " << value << ", expected " << reference
+           << endl;
+    }
+    return isClose;
+
+  }  // end 'IsClose(double, double, string&, size_t)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Make a massless constituent with a given pt, eta, phi
+  // --------------------------------------------------------------------------
+  Types::CstInfo MakeCst(const double pt, const double eta, const double phi) {
+
+    Types::CstInfo cst;
+    cst.SetPT(pt);
+    cst.SetEta(eta);
+    cst.SetPhi(phi);
+    cst.SetPX(pt * cos(phi));
+    cst.SetPY(pt * sin(phi));
+    cst.SetPZ(pt * sinh(eta));
+    cst.SetEne(pt * cosh(eta));
+    return cst;
+
+  }  // end 'MakeCst(double, double, double)'
+
+}  // end anonymous namespace
+
+
+
+// ----------------------------------------------------------------------------
+//! Compare scalar, batch, and column-wise paths to the reference
+// ----------------------------------------------------------------------------
+int main() {
+
+  // jet sitting right below +pi, so some constituents wrap around
+  const double ptJet  = 20.;
+  const double etaJet = 0.3;
+  const double phiJet = M_PI - 0.05;
+
+  Types::JetInfo jet;
+  jet.SetPT(ptJet);
+  jet.SetEta(etaJet);
+  jet.SetPhi(phiJet);
+  jet.SetPX(ptJet * cos(phiJet));
+  jet.SetPY(ptJet * sin(phiJet));
+  jet.SetPZ(ptJet * sinh(etaJet));
+  jet.SetEne(ptJet * cosh(etaJet));
+
+  // constituents on both sides of the +-pi boundary
+  vector<Types::CstInfo> csts = {
+    MakeCst(5.0,  0.30,  M_PI - 0.05),
+    MakeCst(3.0,  0.10,  M_PI - 0.30),
+    MakeCst(2.0,  0.50, -M_PI + 0.10),
+    MakeCst(1.5, -0.20, -M_PI + 0.35),
+    MakeCst(1.0,  0.60,  M_PI - 0.01),
+    MakeCst(0.5,  0.25, -M_PI + 0.01),
+    MakeCst(0.7,  0.00,  2.90),
+    MakeCst(0.3,  0.90, -2.90)
+  };
+
+  // scalar path
+  vector<Types::CstInfo> scalar = csts;
+  for (Types::CstInfo& cst : scalar) {
+    cst.SetJetInfo(1, jet);
+  }
+
+  // batch path (run twice to exercise the reused scratch buffer)
+  vector<Types::CstInfo> batch = csts;
+  Types::CstInfo::SetJetInfo(1, jet, batch);
+  Types::CstInfo::SetJetInfo(1, jet, batch);
+
+  // column-wise path
+  Types::CstColumns columns(csts);
+  columns.SetJetInfo(1, jet);
+
+  bool isGood = true;
+  for (size_t iCst = 0; iCst < csts.size(); ++iCst) {
+
+    double z  = 0.;
+    double dr = 0.;
+    double jt = 0.;
+    GetReference(jet, csts[iCst], z, dr, jt);
+
+    isGood &= IsClose(scalar[iCst].GetZ(),  z,  "scalar z",  iCst);
+    isGood &= IsClose(scalar[iCst].GetDR(), dr, "scalar dR", iCst);
+    isGood &= IsClose(scalar[iCst].GetJT(), jt, "scalar jT", iCst);
+    isGood &= IsClose(batch[iCst].GetZ(),   z,  "batch z",   iCst);
+    isGood &= IsClose(batch[iCst].GetDR(),  dr, "batch dR",  iCst);
+    isGood &= IsClose(batch[iCst].GetJT(),  jt, "batch jT",  iCst);
+    isGood &= IsClose(columns[iCst].GetZ(),  z,  "column z",  iCst);
+    isGood &= IsClose(columns[iCst].GetDR(), dr, "column dR", iCst);
+    isGood &= IsClose(columns[iCst].GetJT(), jt, "column jT", iCst);
+
+    // scalar and batch paths must agree exactly
+    if ((scalar[iCst].GetZ()  != batch[iCst].GetZ())  ||
+        (scalar[iCst].GetDR() != batch[iCst].GetDR()) ||
+        (scalar[iCst].GetJT() != batch[iCst].GetJT())) {
+      cerr << "FAIL: scalar and batch paths differ for constituent " << iCst << endl;
+      isGood = false;
+    }
+  }  // end constituent loop
+
+  // a constituent across the boundary should sit close to the jet
+  if (batch[2].GetDR() > 0.5) {
+    cerr << "FAIL: dR across the +-pi boundary isn't wrapped" << endl;
+    isGood = false;
+  }
+  return isGood ? 0 : 1;
+
+}  // end 'main()'
+
+// end ------------------------------------------------------------------------
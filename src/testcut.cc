@@ -0,0 +1,108 @@
+/// ---------------------------------------------------------------------------
+/*! \file   testcut.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Checks that Cut and ColumnCut accept
+ *  getters of every arithmetic type used
+ *  by the info and column types.
+ */
+/// ---------------------------------------------------------------------------
+
+// c++ utilities
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+// analysis utilities
+#include "Cut.h"
+#include "JetInfo.h"
+#include "ParInfo.h"
+#include "ClustInfo.h"
+#include "JetColumns.h"
+#include "ParColumns.h"
+#include "ClustColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace SColdQcdCorrelatorAnalysis;
+
+
+
+namespace {
+
+  // --------------------------------------------------------------------------
+  //! Check that a mask matches what's expected
+  // --------------------------------------------------------------------------
+  bool IsSame(const vector<uint8_t>& mask, const vector<uint8_t>& expect, const string& what) {
+
+    if (mask != expect) {
+      cerr << "FAIL: " << what << " mask differs from expectation" << endl;
+      return false;
+    }
+    return true;
+
+  }  // end 'IsSame(vector<uint8_t>&, vector<uint8_t>&, string&)'
+
+}  // end anonymous namespace
+
+
+
+// ----------------------------------------------------------------------------
+//! Cut on int64_t, uint64_t, uint32_t, and float fields
+// ----------------------------------------------------------------------------
+int main() {
+
+  bool isGood = true;
+
+  // jets: uint64_t constituent count & uint32_t id
+  vector<Types::JetInfo> jets(3);
+  jets[0].SetNCsts(1);
+  jets[1].SetNCsts(5);
+  jets[2].SetNCsts(9);
+  for (size_t iJet = 0; iJet < jets.size(); ++iJet) {
+    jets[iJet].SetJetID(iJet);
+  }
+
+  Types::Cut<Types::JetInfo> jetCut;
+  jetCut.AddMin(&Types::JetInfo::GetNCsts, 2)
+        .AddMax(&Types::JetInfo::GetJetID, 1);
+  isGood &= IsSame(jetCut.Pass(jets), {0, 1, 0}, "Cut<JetInfo>");
+
+  Types::ColumnCut<Types::JetColumns> jetColCut;
+  jetColCut.AddMin(&Types::JetColumns::GetNCsts, 2)
+           .AddMax(&Types::JetColumns::GetJetID, 1);
+  isGood &= IsSame(jetColCut.Pass(Types::JetColumns(jets)), {0, 1, 0}, "ColumnCut<JetColumns>");
+
+  // particles: float charge
+  vector<Types::ParInfo> pars(3);
+  pars[0].SetCharge(-1.);
+  pars[1].SetCharge(0.);
+  pars[2].SetCharge(1.);
+
+  Types::Cut<Types::ParInfo> parCut;
+  parCut.Add(&Types::ParInfo::GetCharge, -0.5, 0.5);
+  isGood &= IsSame(parCut.Pass(pars), {0, 1, 0}, "Cut<ParInfo>");
+
+  Types::ColumnCut<Types::ParColumns> parColCut;
+  parColCut.Add(&Types::ParColumns::GetCharge, -0.5, 0.5);
+  isGood &= IsSame(parColCut.Pass(Types::ParColumns(pars)), {0, 1, 0}, "ColumnCut<ParColumns>");
+
+  // clusters: int64_t tower count
+  vector<Types::ClustInfo> clusts(3);
+  clusts[0].SetNTwr(0);
+  clusts[1].SetNTwr(3);
+  clusts[2].SetNTwr(12);
+
+  Types::Cut<Types::ClustInfo> clustCut;
+  clustCut.Add(&Types::ClustInfo::GetNTwr, 1, 10);
+  isGood &= IsSame(clustCut.Pass(clusts), {0, 1, 0}, "Cut<ClustInfo>");
+
+  Types::ColumnCut<Types::ClustColumns> clustColCut;
+  clustColCut.Add(&Types::ClustColumns::GetNTwr, 1, 10);
+  isGood &= IsSame(clustColCut.Pass(Types::ClustColumns(clusts)), {0, 1, 0}, "ColumnCut<ClustColumns>");
+  return isGood ? 0 : 1;
+
+}  // end 'main()'
+
+// end ------------------------------------------------------------------------
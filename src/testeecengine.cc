@@ -0,0 +1,181 @@
+/// ---------------------------------------------------------------------------
+/*! \file   testeecengine.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Checks that the blocked EEC pair loop agrees
+ *  with the naive reference loop.
+ */
+/// ---------------------------------------------------------------------------
+
+// c++ utilities
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "Constants.h"
+#include "EECEngine.h"
+#include "CstColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace SColdQcdCorrelatorAnalysis;
+
+
+
+namespace {
+
+  // tolerance on relative differences
+  const double tolerance = 1e-12;
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check that two engines accumulated the same thing
+  // --------------------------------------------------------------------------
+  bool IsSame(const Types::EECEngine& engine, const Types::EECEngine& reference, const string& what) {
+
+    bool isSame = true;
+    if (engine.GetNJets() != reference.GetNJets()) {
+      cerr << "FAIL: " << what << " has " << engine.GetNJets() << " jets, expected " << reference.GetNJets() << endl;
+      isSame = false;
+    }
+    if (engine.GetNPairs() != reference.GetNPairs()) {
+      cerr << "FAIL: " << what << " has " << engine.GetNPairs() << " pairs, expected " << reference.GetNPairs() << endl;
+      isSame = false;
+    }
+
+    // compare bin contents & errors (including under/overflow)
+    for (size_t bin = 0; bin < reference.GetSumW().size(); ++bin) {
+      const double sumW   = engine.GetSumW()[bin];
+      const double sumW2  = engine.GetSumW2()[bin];
+      const double refW   = reference.GetSumW()[bin];
+      const double refW2  = reference.GetSumW2()[bin];
+      const bool   isGood = (abs(sumW - refW) <= (tolerance * max(1., abs(refW)))) &&
+                            (abs(sumW2 - refW2) <= (tolerance * max(1., abs(refW2))));
+      if (!isGood) {
+        cerr << "FAIL: " << what << " bin " << bin
+             << " = " << sumW << " +- " << sqrt(sumW2)
+             << ", expected " << refW << " +- " << sqrt(refW2)
+             << endl;
+        isSame = false;
+      }
+    }
+    return isSame;
+
+  }  // end 'IsSame(Types::EECEngine&, Types::EECEngine&, string&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Make a random jet of massless constituents
+  // --------------------------------------------------------------------------
+  /*! Jets sit close to phi = +-pi so that
+   *  some pairs wrap around. Constituents are
+   *  a mix of tracks, towers, and particles
+   *  to exercise the charge subsets.
+   */
+  void MakeJet(mt19937& rng, Types::JetInfo& jet, vector<Types::CstInfo>& csts) {
+
+    uniform_int_distribution<size_t> nDist(0, 150);
+    uniform_real_distribution<double> ptDist(0.2, 10.);
+    normal_distribution<double>       angDist(0., 0.3);
+
+    const int    types[4] = {Const::Object::Track, Const::Object::Tower, Const::Object::Particle, Const::Object::Particle};
+    const int    pids[4]  = {211, 22, 2212, 2112};
+    const double etaJet   = 0.4;
+    const double phiJet   = M_PI - 0.1;
+
+    csts.clear();
+    double pxJet  = 0.;
+    double pyJet  = 0.;
+    double pzJet  = 0.;
+    double eneJet = 0.;
+    const size_t nCst = nDist(rng);
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+
+      const double pt  = ptDist(rng);
+      const double eta = etaJet + angDist(rng);
+      const double phi = remainder(phiJet + angDist(rng), 2. * M_PI);
+
+      Types::CstInfo cst;
+      cst.SetType(types[iCst % 4]);
+      cst.SetPID(pids[iCst % 4]);
+      cst.SetPT(pt);
+      cst.SetEta(eta);
+      cst.SetPhi(phi);
+      cst.SetPX(pt * cos(phi));
+      cst.SetPY(pt * sin(phi));
+      cst.SetPZ(pt * sinh(eta));
+      cst.SetEne(pt * cosh(eta));
+      csts.push_back(cst);
+
+      pxJet  += cst.GetPX();
+      pyJet  += cst.GetPY();
+      pzJet  += cst.GetPZ();
+      eneJet += cst.GetEne();
+    }
+
+    jet = Types::JetInfo();
+    jet.SetPX(pxJet);
+    jet.SetPY(pyJet);
+    jet.SetPZ(pzJet);
+    jet.SetEne(max(eneJet, 1.));
+    jet.SetPT(max(hypot(pxJet, pyJet), 1.));
+    return;
+
+  }  // end 'MakeJet(mt19937&, Types::JetInfo&, vector<Types::CstInfo>&)'
+
+}  // end anonymous namespace
+
+
+
+// ----------------------------------------------------------------------------
+//! Compare blocked and column-wise fills to the reference
+// ----------------------------------------------------------------------------
+int main() {
+
+  const Const::Subset    subsets[3]    = {Const::Subset::All, Const::Subset::Charged, Const::Subset::Neutral};
+  const Const::EECWeight weights[2]    = {Const::EECWeight::Energy, Const::EECWeight::Pt};
+  const size_t           blockSizes[4] = {1, 7, 64, 1000};
+
+  bool isGood = true;
+  for (const Const::Subset subset : subsets) {
+    for (const Const::EECWeight weight : weights) {
+      for (const size_t blockSize : blockSizes) {
+
+        Types::EECEngine blocked(20, 1e-3, 1., weight, subset);
+        Types::EECEngine columns(20, 1e-3, 1., weight, subset);
+        Types::EECEngine reference(20, 1e-3, 1., weight, subset);
+        blocked.SetBlockSize(blockSize);
+        columns.SetBlockSize(blockSize);
+
+        // fill same jets with each path
+        mt19937                rng(12345);
+        Types::JetInfo         jet;
+        vector<Types::CstInfo> csts;
+        for (size_t iJet = 0; iJet < 50; ++iJet) {
+          MakeJet(rng, jet, csts);
+          const double evtWeight = 0.5 + (0.1 * (iJet % 7));
+          blocked.Fill(jet, csts, evtWeight);
+          columns.Fill(jet, Types::CstColumns(csts), evtWeight);
+          reference.FillReference(jet, csts, evtWeight);
+        }
+
+        const string what = "subset " + to_string(static_cast<int>(subset))
+                          + ", weight " + to_string(static_cast<int>(weight))
+                          + ", block " + to_string(blockSize);
+        isGood &= IsSame(blocked, reference, "blocked (" + what + ")");
+        isGood &= IsSame(columns, reference, "columns (" + what + ")");
+      }  // end block size loop
+    }  // end weight loop
+  }  // end subset loop
+  return isGood ? 0 : 1;
+
+}  // end 'main()'
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,234 @@
+/// ---------------------------------------------------------------------------
+/*! \file   testencengine.cc
+ *  \author Derek Anderson
+ *  \date   10.16.2026
+ *
+ *  Checks that the ENC tuple kernel agrees
+ *  with the naive reference loop, including
+ *  for tied and coincident pairs.
+ */
+/// ---------------------------------------------------------------------------
+
+// c++ utilities
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "Constants.h"
+#include "ENCEngine.h"
+#include "CstColumns.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace SColdQcdCorrelatorAnalysis;
+
+
+
+namespace {
+
+  // tolerance on relative differences
+  const double tolerance = 1e-12;
+
+  // kinds of jets to test
+  enum class Shape {Random, Lattice, Coincident};
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check that two engines accumulated the same thing
+  // --------------------------------------------------------------------------
+  bool IsSame(const Types::ENCEngine& engine, const Types::ENCEngine& reference, const string& what) {
+
+    bool isSame = true;
+    if (engine.GetNJets() != reference.GetNJets()) {
+      cerr << "FAIL: " << what << " has " << engine.GetNJets() << " jets, expected " << reference.GetNJets() << endl;
+      isSame = false;
+    }
+
+    // compare bin contents & errors (including under/overflow)
+    for (size_t bin = 0; bin < reference.GetSumW().size(); ++bin) {
+      const double sumW   = engine.GetSumW()[bin];
+      const double sumW2  = engine.GetSumW2()[bin];
+      const double refW   = reference.GetSumW()[bin];
+      const double refW2  = reference.GetSumW2()[bin];
+      const bool   isGood = (abs(sumW - refW) <= (tolerance * max(1., abs(refW)))) &&
+                            (abs(sumW2 - refW2) <= (tolerance * max(1., abs(refW2))));
+      if (!isGood) {
+        cerr << "FAIL: " << what << " bin " << bin
+             << " = " << sumW << " +- " << sqrt(sumW2)
+             << ", expected " << refW << " +- " << sqrt(refW2)
+             << endl;
+        isSame = false;
+      }
+    }
+    return isSame;
+
+  }  // end 'IsSame(Types::ENCEngine&, Types::ENCEngine&, string&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Check that nothing leaked into the overflow
+  // --------------------------------------------------------------------------
+  /*! For use when the binned range covers
+   *  every tuple: the overflow must then be
+   *  exactly empty, not rounding noise.
+   */
+  bool IsOverflowEmpty(const Types::ENCEngine& engine, const string& what) {
+
+    const size_t overflow = engine.GetNBins() + 1;
+    if ((engine.GetSumW()[overflow] != 0.) || (engine.GetSumW2()[overflow] != 0.)) {
+      cerr << "FAIL: " << what << " overflow = " << engine.GetSumW()[overflow]
+           << " +- " << sqrt(engine.GetSumW2()[overflow])
+           << ", expected 0"
+           << endl;
+      return false;
+    }
+    return true;
+
+  }  // end 'IsOverflowEmpty(Types::ENCEngine&, string&)'
+
+
+
+  // --------------------------------------------------------------------------
+  //! Make a jet of massless constituents
+  // --------------------------------------------------------------------------
+  /*! Random jets sit close to phi = +-pi so
+   *  that some pairs wrap around. Lattice jets
+   *  put constituents on a grid with a spacing
+   *  of 1/8, so that many pair distances are
+   *  exactly tied. Coincident jets are random
+   *  jets where some constituents share the
+   *  same (eta, phi), so that R_L = 0.
+   */
+  void MakeJet(mt19937& rng, const Shape shape, Types::JetInfo& jet, vector<Types::CstInfo>& csts) {
+
+    uniform_int_distribution<size_t>  nDist(0, 24);
+    uniform_int_distribution<int>     gridDist(-2, 2);
+    uniform_real_distribution<double> ptDist(0.2, 10.);
+    normal_distribution<double>       angDist(0., 0.3);
+
+    const int    types[4] = {Const::Object::Track, Const::Object::Tower, Const::Object::Particle, Const::Object::Particle};
+    const int    pids[4]  = {211, 22, 2212, 2112};
+    const double etaJet   = 0.5;
+    const double phiJet   = (shape == Shape::Lattice) ? 0.25 : M_PI - 0.1;
+
+    csts.clear();
+    double pxJet  = 0.;
+    double pyJet  = 0.;
+    double pzJet  = 0.;
+    double eneJet = 0.;
+    const size_t nCst = nDist(rng);
+    for (size_t iCst = 0; iCst < nCst; ++iCst) {
+
+      const double pt = ptDist(rng);
+
+      double eta = etaJet;
+      double phi = phiJet;
+      if ((shape == Shape::Coincident) && (iCst % 3 == 2)) {
+        eta = csts[iCst - 1].GetEta();
+        phi = csts[iCst - 1].GetPhi();
+      } else if (shape == Shape::Lattice) {
+        eta = etaJet + (0.125 * gridDist(rng));
+        phi = phiJet + (0.125 * gridDist(rng));
+      } else {
+        eta = etaJet + angDist(rng);
+        phi = remainder(phiJet + angDist(rng), 2. * M_PI);
+      }
+
+      Types::CstInfo cst;
+      cst.SetType(types[iCst % 4]);
+      cst.SetPID(pids[iCst % 4]);
+      cst.SetPT(pt);
+      cst.SetEta(eta);
+      cst.SetPhi(phi);
+      cst.SetPX(pt * cos(phi));
+      cst.SetPY(pt * sin(phi));
+      cst.SetPZ(pt * sinh(eta));
+      cst.SetEne(pt * cosh(eta));
+      csts.push_back(cst);
+
+      pxJet  += cst.GetPX();
+      pyJet  += cst.GetPY();
+      pzJet  += cst.GetPZ();
+      eneJet += cst.GetEne();
+    }
+
+    jet = Types::JetInfo();
+    jet.SetPX(pxJet);
+    jet.SetPY(pyJet);
+    jet.SetPZ(pzJet);
+    jet.SetEne(max(eneJet, 1.));
+    jet.SetPT(max(hypot(pxJet, pyJet), 1.));
+    return;
+
+  }  // end 'MakeJet(mt19937&, Shape, Types::JetInfo&, vector<Types::CstInfo>&)'
+
+}  // end anonymous namespace
+
+
+
+// ----------------------------------------------------------------------------
+//! Compare tuple kernel fills to the reference
+// ----------------------------------------------------------------------------
+/*! Each configuration is run with a range
+ *  which cuts into the tuples, so that the
+ *  overflow is derived from the total, and
+ *  with one which holds every tuple.
+ */
+int main() {
+
+  const size_t           points[2]  = {3, 4};
+  const Shape            shapes[3]  = {Shape::Random, Shape::Lattice, Shape::Coincident};
+  const Const::Subset    subsets[2] = {Const::Subset::All, Const::Subset::Charged};
+  const Const::EECWeight weights[2] = {Const::EECWeight::Energy, Const::EECWeight::Pt};
+  const double           rlMaxes[2] = {0.3, 10.};
+
+  bool isGood = true;
+  for (const size_t nPoints : points) {
+    for (const Shape shape : shapes) {
+      for (const Const::Subset subset : subsets) {
+        for (const Const::EECWeight weight : weights) {
+          for (const double rlMax : rlMaxes) {
+
+            Types::ENCEngine tuples(nPoints, 15, 1e-3, rlMax, weight, subset);
+            Types::ENCEngine columns(nPoints, 15, 1e-3, rlMax, weight, subset);
+            Types::ENCEngine reference(nPoints, 15, 1e-3, rlMax, weight, subset);
+
+            // fill same jets with each path
+            mt19937                rng(12345);
+            Types::JetInfo         jet;
+            vector<Types::CstInfo> csts;
+            for (size_t iJet = 0; iJet < 20; ++iJet) {
+              MakeJet(rng, shape, jet, csts);
+              const double evtWeight = 0.5 + (0.1 * (iJet % 7));
+              tuples.Fill(jet, csts, evtWeight);
+              columns.Fill(jet, Types::CstColumns(csts), evtWeight);
+              reference.FillReference(jet, csts, evtWeight);
+            }
+
+            const string what = "N = " + to_string(nPoints)
+                              + ", shape " + to_string(static_cast<int>(shape))
+                              + ", subset " + to_string(static_cast<int>(subset))
+                              + ", weight " + to_string(static_cast<int>(weight))
+                              + ", max " + to_string(rlMax);
+            isGood &= IsSame(tuples, reference, "tuples (" + what + ")");
+            isGood &= IsSame(columns, reference, "columns (" + what + ")");
+            if (rlMax > 1.) {
+              isGood &= IsOverflowEmpty(tuples, "tuples (" + what + ")");
+              isGood &= IsOverflowEmpty(columns, "columns (" + what + ")");
+            }
+          }  // end max loop
+        }  // end weight loop
+      }  // end subset loop
+    }  // end shape loop
+  }  // end point loop
+  return isGood ? 0 : 1;
+
+}  // end 'main()'
+
+// end ------------------------------------------------------------------------